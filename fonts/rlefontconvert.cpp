@@ -0,0 +1,230 @@
+/*
+Host-side converter from TTF to the run-length encoded font format used by the crescendo clock (see src/rle_font.hpp).
+
+It is based on the fontconvert tool from Adafruit (https://github.com/adafruit/Adafruit-GFX-Library/tree/master/fontconvert)
+and uses the very same FreeType settings, so the generated glyphs are pixel identical to the GFX fonts generated by it.
+Instead of a plain bitmap each glyph is stored as a list of rectangles ("spans"): every row of the glyph bounding box is
+split into horizontal runs of foreground pixels, and runs repeating in the following rows with the same position and
+length are merged into a single rectangle. A solid stem of the 75pt digits becomes a single span instead of 130 bitmap
+rows. Background runs are not stored, the renderer derives them from the foreground spans.
+
+Unlike fontconvert, several character ranges can be given. Characters in between are stored as empty glyphs.
+
+Build:
+    g++ -O2 -o rlefontconvert rlefontconvert.cpp $(pkg-config --cflags --libs freetype2)
+Usage:
+    ./rlefontconvert fontfile size ranges > header.h
+    e.g. ./rlefontconvert Antonio-Regular.ttf 26 32,48-70 > Antonio_Regular26ptRLE.h
+*/
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include FT_GLYPH_H
+#include FT_MODULE_H
+#include FT_TRUETYPE_DRIVER_H
+
+#define DPI 141  // Approximate res. of Adafruit 2.8" TFT, used by fontconvert as well
+
+typedef struct {
+    uint8_t x;
+    uint8_t y;
+    uint8_t w;
+    uint8_t h;
+} span_t;
+
+typedef struct {
+    uint16_t span_offset;
+    uint16_t span_count;
+    uint8_t width;
+    uint8_t height;
+    uint8_t x_advance;
+    int8_t x_offset;
+    int8_t y_offset;
+} glyph_t;
+
+// Split each row into runs of foreground pixels and merge runs which repeat in the following rows
+static void encodeSpans(const std::vector<uint8_t> &pixels, int width, int height, std::vector<span_t> *spans) {
+    std::vector<span_t> open;  // Rectangles which may still grow downwards
+
+    for (int y = 0; y <= height; y++) {
+        std::vector<span_t> row;
+        if (y < height) {
+            int x = 0;
+            while (x < width) {
+                if (!pixels[y * width + x]) {
+                    x++;
+                    continue;
+                }
+                int start = x;
+                while (x < width && pixels[y * width + x]) x++;
+                row.push_back({(uint8_t)start, (uint8_t)y, (uint8_t)(x - start), 1});
+            }
+        }
+
+        std::vector<span_t> still_open;
+        for (const span_t &o : open) {
+            bool extended = false;
+            for (span_t &r : row) {
+                if (r.h == 1 && r.y == y && r.x == o.x && r.w == o.w && o.h < 255) {
+                    // Mark the run as consumed by growing the open rectangle instead
+                    still_open.push_back({o.x, o.y, o.w, (uint8_t)(o.h + 1)});
+                    r.h = 0;
+                    extended = true;
+                    break;
+                }
+            }
+            if (!extended) spans->push_back(o);
+        }
+        for (const span_t &r : row) {
+            if (r.h == 1) still_open.push_back(r);
+        }
+        open = still_open;
+    }
+}
+
+// Parses a list of ranges like "32,48-70" into a flag per character
+static bool parseRanges(const char *ranges, bool *included, int *first, int *last) {
+    *first = 256;
+    *last = -1;
+    const char *p = ranges;
+    while (*p) {
+        char *end;
+        long from = strtol(p, &end, 0);
+        long to = from;
+        if (end == p) return false;
+        if (*end == '-') {
+            p = end + 1;
+            to = strtol(p, &end, 0);
+            if (end == p) return false;
+        }
+        if (from < 0 || to > 255 || from > to) return false;
+        for (long c = from; c <= to; c++) included[c] = true;
+        if (from < *first) *first = (int)from;
+        if (to > *last) *last = (int)to;
+        p = (*end == ',') ? end + 1 : end;
+        if (*end != ',' && *end != '\0') return false;
+    }
+    return *last >= *first;
+}
+
+int main(int argc, char *argv[]) {
+    int size, first, last;
+    bool included[256] = {};
+    FT_Library library;
+    FT_Face face;
+    FT_Error err;
+    FT_UInt interpreter_version = TT_INTERPRETER_VERSION_35;
+
+    if (argc != 4 || !parseRanges(argv[3], included, &first, &last)) {
+        fprintf(stderr, "Usage: %s fontfile size ranges (e.g. 32,48-70)\n", argv[0]);
+        return 1;
+    }
+    size = atoi(argv[2]);
+
+    // Derive the font name from the file name, e.g. Antonio-SemiBold.ttf -> Antonio_SemiBold75ptRLE
+    std::string name = argv[1];
+    size_t pos = name.find_last_of('/');
+    if (pos != std::string::npos) name = name.substr(pos + 1);
+    pos = name.find_last_of('.');
+    if (pos != std::string::npos) name = name.substr(0, pos);
+    for (char &c : name) {
+        if (!isalnum((unsigned char)c)) c = '_';
+    }
+    name += std::to_string(size) + "ptRLE";
+
+    if ((err = FT_Init_FreeType(&library))) {
+        fprintf(stderr, "FreeType init error: %d\n", err);
+        return err;
+    }
+    // Use TrueType engine version 35, without subpixel rendering, same as fontconvert
+    FT_Property_Set(library, "truetype", "interpreter-version", &interpreter_version);
+    if ((err = FT_New_Face(library, argv[1], 0, &face))) {
+        fprintf(stderr, "Font load error: %d\n", err);
+        FT_Done_FreeType(library);
+        return err;
+    }
+    FT_Set_Char_Size(face, size << 6, 0, DPI, 0);
+
+    std::vector<span_t> spans;
+    std::vector<glyph_t> glyphs;
+    int baseline = 0;
+    int descent = 0;
+
+    for (int i = first; i <= last; i++) {
+        glyph_t glyph = {};
+        glyph.span_offset = (uint16_t)spans.size();
+
+        if (!included[i]) {
+            // Not needed, only the (empty) table entry is kept
+        } else if ((err = FT_Load_Char(face, i, FT_LOAD_TARGET_MONO))) {
+            fprintf(stderr, "Error %d loading char '%c'\n", err, i);
+        } else if ((err = FT_Render_Glyph(face->glyph, FT_RENDER_MODE_MONO))) {
+            fprintf(stderr, "Error %d rendering char '%c'\n", err, i);
+        } else {
+            FT_Bitmap *bitmap = &face->glyph->bitmap;
+            int width = bitmap->width;
+            int height = bitmap->rows;
+
+            std::vector<uint8_t> pixels(width * height);
+            for (int y = 0; y < height; y++) {
+                for (int x = 0; x < width; x++) {
+                    uint8_t byte = bitmap->buffer[y * bitmap->pitch + x / 8];
+                    pixels[y * width + x] = (byte & (0x80 >> (x & 7))) ? 1 : 0;
+                }
+            }
+            encodeSpans(pixels, width, height, &spans);
+            glyph.span_count = (uint16_t)(spans.size() - glyph.span_offset);
+
+            glyph.width = (uint8_t)width;
+            glyph.height = (uint8_t)height;
+            glyph.x_advance = (uint8_t)(face->glyph->advance.x >> 6);
+            glyph.x_offset = (int8_t)face->glyph->bitmap_left;
+            glyph.y_offset = (int8_t)(1 - face->glyph->bitmap_top);
+
+            if (height > 0) {
+                if (-glyph.y_offset > baseline) baseline = -glyph.y_offset;
+                if (glyph.y_offset + height > descent) descent = glyph.y_offset + height;
+            }
+        }
+        glyphs.push_back(glyph);
+    }
+
+    printf("// Generated by rlefontconvert from %s, size %d, characters %s\n", argv[1], size, argv[3]);
+    printf("constexpr uint8_t %sSpans[] PROGMEM = {", name.c_str());
+    for (size_t s = 0; s < spans.size(); s++) {
+        printf("%s%3d, %3d, %3d, %3d%s", (s % 4) ? " " : "\n  ", spans[s].x, spans[s].y, spans[s].w, spans[s].h,
+               (s + 1 < spans.size()) ? "," : "");
+    }
+    printf(" };\n\n");
+
+    printf("constexpr RLEglyph %sGlyphs[] PROGMEM = {\n", name.c_str());
+    for (size_t g = 0; g < glyphs.size(); g++) {
+        int c = first + (int)g;
+        printf("  { %5d, %4d, %4d, %4d, %4d, %4d, %4d }%s   // 0x%02X", glyphs[g].span_offset, glyphs[g].span_count,
+               glyphs[g].width, glyphs[g].height, glyphs[g].x_advance, glyphs[g].x_offset, glyphs[g].y_offset,
+               (g + 1 < glyphs.size()) ? ", " : " };", c);
+        if (c >= ' ' && c <= '~' && c != '\\') printf(" '%c'", c);
+        printf("\n");
+    }
+    printf("\n");
+
+    printf("constexpr RLEfont %s PROGMEM = {\n", name.c_str());
+    printf("  %sSpans,\n", name.c_str());
+    printf("  %sGlyphs,\n", name.c_str());
+    printf("  0x%02X, 0x%02X, %ld, %d, %d };\n\n", first, last, face->size->metrics.height >> 6, baseline,
+           baseline + descent);
+
+    size_t rle_bytes = spans.size() * sizeof(span_t) + glyphs.size() * sizeof(glyph_t);
+    printf("// Approx. %d bytes (%d spans)\n", (int)rle_bytes, (int)spans.size());
+
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+    return 0;
+}
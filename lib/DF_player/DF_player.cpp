@@ -9,7 +9,26 @@ static const char *TAG = "df_player";
 void DFPlayer::monitorSerialTask(void *pvParameter) {
     DFPlayer *pThis = (DFPlayer *)pvParameter;
     while (1) {
-        pThis->receiveData();
+        if (pThis->receiveData(DFPLAYER_STATUS_CHECK_MS / portTICK_PERIOD_MS))
+            continue;
+        // Nothing from the player for a while. A player which is gone sends nothing, so it is asked for its status
+        pThis->sendData(0x42);
+        if (!pThis->receiveData(DFPLAYER_REPLY_TIMEOUT_MS / portTICK_PERIOD_MS))
+            pThis->checkReply();
+    }
+}
+
+void DFPlayer::checkReply(void) {
+    // The player answers every command, as the feedback is requested. If it has not for a while, it is offline
+    if (!reply_pending || (xTaskGetTickCount() - command_tick) < DFPLAYER_REPLY_TIMEOUT_MS / portTICK_PERIOD_MS)
+        return;
+    reply_pending = false;
+    if (is_device_online) {
+        is_device_online = false;
+        last_event = DFPLAYER_OFFLINE;
+        ESP_LOGE(TAG, "New event: player offline, no reply");
+        if (event_callback != NULL)
+            event_callback(last_event, event_callback_arg);
     }
 }
 
@@ -39,13 +58,14 @@ bool DFPlayer::init(uart_port_t uart_port_number, int pin_tx, int pin_rx) {
     return (checkCurrentStatus());
 }
 
-void DFPlayer::receiveData(uint16_t timeout_ms) {
-    TickType_t ticks_to_wait;
-    if (timeout_ms == 0)
-        ticks_to_wait = portMAX_DELAY;
-    else
-        ticks_to_wait = timeout_ms / portTICK_PERIOD_MS;
+// Set it before init, the monitoring task may report the player online right away
+void DFPlayer::setEventCallback(dfplayer_callback_t callback, void *arg) {
+    event_callback_arg = arg;
+    event_callback = callback;
+}
 
+// Returns false if nothing has been received within ticks_to_wait
+bool DFPlayer::receiveData(TickType_t ticks_to_wait) {
     // Now get the reply
     int number_of_bytes = 0;
     uint8_t rcvd_buffer[RECEIVE_LENGTH];
@@ -63,7 +83,7 @@ void DFPlayer::receiveData(uint16_t timeout_ms) {
                 (rcvd_buffer[POS_LENGTH] != DATA_LENGTH) || (rcvd_buffer[POS_END] != DATA_END)) {
                 last_event = DFPLAYER_WRONG_DATA;
                 ESP_LOGE(TAG, "New event: wrong data");
-                return;
+                return true;
             }
             if (calculateCRC(rcvd_buffer) == (rcvd_buffer[POS_CHECKSUM] << 8) + (rcvd_buffer[POS_CHECKSUM + 1])) {
                 decodeReceiveData(rcvd_buffer);
@@ -73,8 +93,9 @@ void DFPlayer::receiveData(uint16_t timeout_ms) {
             }
         }
     } else {
-        ESP_LOGE(TAG, "Expecting to get some bytes, but nothing there");
+        return false;
     }
+    return true;
 }
 
 void DFPlayer::sendData(uint8_t command, uint16_t parameter) {
@@ -89,6 +110,8 @@ void DFPlayer::sendData(uint8_t command, uint16_t parameter) {
     data_buffer[POS_CHECKSUM] = (uint8_t)(data_CRC >> 8);
     data_buffer[POS_CHECKSUM + 1] = (uint8_t)data_CRC;
 
+    command_tick = xTaskGetTickCount();
+    reply_pending = true;
     uart_write_bytes(uart_port_nr, (const char *)data_buffer, SEND_LENGTH);
     vTaskDelay(200 / portTICK_PERIOD_MS);
 }
@@ -104,6 +127,7 @@ uint16_t DFPlayer::calculateCRC(uint8_t *buffer) {
 void DFPlayer::decodeReceiveData(uint8_t *rcvd_buffer) {
     uint8_t command = rcvd_buffer[POS_COMMAND];
     uint16_t parameter = static_cast<uint16_t>(rcvd_buffer[POS_PARAMETER] << 8) + (rcvd_buffer[POS_PARAMETER + 1]);
+    reply_pending = false;
     switch (command) {
         case 0x3D:
             last_event = DFPLAYER_PLAY_FINISHED;
@@ -134,7 +158,13 @@ void DFPlayer::decodeReceiveData(uint8_t *rcvd_buffer) {
             ESP_LOGE(TAG, "New event: player error, parameter = %d", parameter);
             break;
         case 0x41:
-            // Command reply, we can ignore this
+            // Command reply, we can ignore this. Unless the player was offline, then it is back
+            if (is_device_online)
+                return;
+            is_device_online = true;
+            ESP_LOGI(TAG, "New event: player answered, online");
+            if (event_callback != NULL)
+                event_callback(DFPLAYER_ONLINE, event_callback_arg);
             return;
         case 0x42:
         case 0x43:
@@ -154,8 +184,10 @@ void DFPlayer::decodeReceiveData(uint8_t *rcvd_buffer) {
         default:
             ESP_LOGE(TAG, "Unknown event with ID %X", command);
             // Something else happened, we just ignore this
-            break;
+            return;
     }
+    if (event_callback != NULL)
+        event_callback(last_event, event_callback_arg);
 }
 
 bool DFPlayer::checkFeedbackValidityFromCommand(uint8_t command) {
@@ -22,6 +22,9 @@
 #define DATA_FEEDBACK   0x01
 #define DATA_END        0xEF
 
+#define DFPLAYER_REPLY_TIMEOUT_MS   500     // Every command is answered within this, unless the player is offline
+#define DFPLAYER_STATUS_CHECK_MS    300000  // Without any message for this long, the status is queried
+
 typedef enum {
     DFPLAYER_NO_EVENT = 0,
     DFPLAYER_ONLINE,
@@ -31,23 +34,33 @@ typedef enum {
     DFPLAYER_CARD_REMOVED,
     DFPLAYER_PLAY_FINISHED,
     DFPLAYER_RESPONSE_RECEIVED,
+    DFPLAYER_OFFLINE,
 } dfplayer_event_t;
 
+// Called from the monitoring task for every message decoded from the player, and when it has stopped answering
+typedef void (*dfplayer_callback_t)(dfplayer_event_t event, void *arg);
+
 class DFPlayer {
     uart_port_t uart_port_nr;
     bool is_device_online = false;
     dfplayer_event_t last_event = DFPLAYER_NO_EVENT;
     uint16_t received_response;
+    dfplayer_callback_t event_callback = NULL;
+    void *event_callback_arg = NULL;
+    volatile bool reply_pending = false;  // A command has been sent, the player has not sent anything since
+    volatile TickType_t command_tick = 0;
 
     static void monitorSerialTask(void *pvParameter);
     void sendData(uint8_t command, uint16_t parameter = 0);
-    void receiveData(uint16_t timeout_ms = 0);
+    bool receiveData(TickType_t ticks_to_wait);
+    void checkReply(void);
     uint16_t calculateCRC(uint8_t *buffer);
     void decodeReceiveData(uint8_t *buffer);
     bool checkFeedbackValidityFromCommand(uint8_t command);
 
    public:
     bool init(uart_port_t uart_port_number, int tx_pin, int rx_pin);
+    void setEventCallback(dfplayer_callback_t callback, void *arg);
     bool isDeviceOnline() { return is_device_online; }
 
     void playTrack(int file_number) { sendData(0x03, file_number); }
@@ -31,6 +31,11 @@ bool RotaryEncoder::buttonUp(button_debounce_t *d) {
     return buttonFell(d);
 }
 
+bool RotaryEncoder::buttonIdle(button_debounce_t *d) {
+    // Released for the whole history and no press pending
+    return (d->down_time == 0) && (d->history == (d->inverted ? 0xffff : 0x0000));
+}
+
 uint32_t RotaryEncoder::getTimeInMs() {
     return esp_timer_get_time() / 1000;
 }
@@ -42,16 +47,33 @@ void RotaryEncoder::sendButtonEvent(rotary_encoder_event_type_t event_type) {
             .position = position,
             .direction = direction,
         };
-    xQueueSend(queue, &event, portMAX_DELAY);
+    if (event_callback != NULL) {
+        event_callback(&event, false, event_callback_arg);
+    } else {
+        xQueueSend(queue, &event, portMAX_DELAY);
+    }
 }
 
 void RotaryEncoder::buttonTask(void *pvParameter) {
     RotaryEncoder *pThis = (RotaryEncoder *)pvParameter;
     while (1) {
+        // The button is only sampled while it is in use, otherwise the task sleeps until an edge wakes it up
+        if (pThis->buttonIdle(&pThis->debounce)) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        }
         pThis->processButton();
     }
 }
 
+void RotaryEncoder::buttonInterruptHandler(void *pvParameter) {
+    RotaryEncoder *pThis = (RotaryEncoder *)pvParameter;
+    BaseType_t higher_priority_task_woken = pdFALSE;
+    vTaskNotifyGiveFromISR(pThis->button_task, &higher_priority_task_woken);
+    if (higher_priority_task_woken == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
 void RotaryEncoder::processButton() {
     updateButton(&debounce);
     if (buttonUp(&debounce) && debounce.down_time) {
@@ -64,7 +86,7 @@ void RotaryEncoder::processButton() {
     } else if (buttonDown(&debounce) && (debounce.down_time == 0)) {
         debounce.down_time = getTimeInMs();
     }
-    vTaskDelay(10 / portTICK_PERIOD_MS);
+    vTaskDelay(DEBOUNCE_PERIOD_MS / portTICK_PERIOD_MS);
 }
 
 void RotaryEncoder::rotationInterruptHandler(void *pvParameter) {
@@ -122,7 +144,11 @@ void RotaryEncoder::processEncoderInterrupt() {
                 .direction = direction,
             };
         BaseType_t higher_priority_task_woken = pdFALSE;
-        xQueueOverwriteFromISR(queue, &event, &higher_priority_task_woken);
+        if (event_callback != NULL) {
+            higher_priority_task_woken = event_callback(&event, true, event_callback_arg) ? pdTRUE : pdFALSE;
+        } else {
+            xQueueOverwriteFromISR(queue, &event, &higher_priority_task_woken);
+        }
         if (higher_priority_task_woken == pdTRUE) {
             portYIELD_FROM_ISR();
         }
@@ -164,11 +190,20 @@ QueueHandle_t RotaryEncoder::init(gpio_num_t A, gpio_num_t B, gpio_num_t button,
     if (debounce.inverted) debounce.history = 0xffff;
 
     queue = xQueueCreate(1, sizeof(rotary_encoder_event_t));
-    xTaskCreate(this->buttonTask, "button_task", 2048, this, 10, NULL);
+    xTaskCreate(this->buttonTask, "button_task", 2048, this, 10, &button_task);
+    // Any edge of the button wakes up the task, which then debounces it
+    gpio_set_intr_type(pin_button, GPIO_INTR_ANYEDGE);
+    gpio_isr_handler_add(pin_button, this->buttonInterruptHandler, this);
 
     return queue;
 }
 
+// Set it before init: it is not synchronised with the interrupt handler, and nobody would read the queue
+void RotaryEncoder::setEventCallback(rotary_encoder_callback_t callback, void *arg) {
+    event_callback_arg = arg;
+    event_callback = callback;
+}
+
 void RotaryEncoder::setRange(rotary_encoder_pos_t min, rotary_encoder_pos_t max, rotary_encoder_pos_t step, bool wrap) {
     assert(min <= max);
     assert(step >= 1);
@@ -3,9 +3,11 @@
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
+#include "freertos/task.h"
 #include "driver/gpio.h"
 
 #define DEBOUNCE_MASK   0b1111000000111111
+#define DEBOUNCE_PERIOD_MS  (10)
 #define LONG_PRESS_DURATION (1000)
 
 typedef int16_t rotary_encoder_pos_t;
@@ -36,12 +38,19 @@ typedef struct
     rotary_encoder_dir_t direction;
 } rotary_encoder_event_t;
 
+// Receives the events instead of the queue, if set. Rotations are reported from the interrupt handler (in_isr), then
+// the callback returns true if it has woken up a task of higher priority
+typedef bool (*rotary_encoder_callback_t)(const rotary_encoder_event_t *event, bool in_isr, void *arg);
+
 class RotaryEncoder {
     gpio_num_t pin_a;
     gpio_num_t pin_b;
     gpio_num_t pin_button;
     button_debounce_t debounce;
     QueueHandle_t queue;
+    rotary_encoder_callback_t event_callback = NULL;
+    void *event_callback_arg = NULL;
+    TaskHandle_t button_task = NULL;
     uint8_t encoder_state = 0;
     rotary_encoder_dir_t encoder_started_rotation = DIR_NONE;
     rotary_encoder_pos_t position;
@@ -56,15 +65,18 @@ class RotaryEncoder {
     bool buttonFell(button_debounce_t *d);
     bool buttonDown(button_debounce_t *d);
     bool buttonUp(button_debounce_t *d);
+    bool buttonIdle(button_debounce_t *d);
     uint32_t getTimeInMs();
     void sendButtonEvent(rotary_encoder_event_type_t event_type);
     static void buttonTask(void *pvParameter);
+    static void buttonInterruptHandler(void *pvParameter);
     void processButton();
     static void rotationInterruptHandler(void *pvParameter);
     void processEncoderInterrupt();
 
    public:
     QueueHandle_t init(gpio_num_t pin_a, gpio_num_t pin_b, gpio_num_t pin_button, bool inverted);
+    void setEventCallback(rotary_encoder_callback_t callback, void *arg);
     void setRange(rotary_encoder_pos_t min, rotary_encoder_pos_t max, rotary_encoder_pos_t step, bool wrap);
     void setPosition(rotary_encoder_pos_t position);
     rotary_encoder_pos_t getPosition();
@@ -1,85 +0,0 @@
-const uint8_t Antonio_Light16pt7bBitmaps[] PROGMEM = {
-  0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-  0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-  0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-  0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-  0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0x3F, 0x1F, 0xE7, 0x3B, 0x87, 0xE1,
-  0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x03, 0x80, 0xE0, 0x39, 0xFE,
-  0x7F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87,
-  0x73, 0xDF, 0xF3, 0xEC, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E,
-  0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xFF, 0xFF, 0xFE, 0x0F, 0x83,
-  0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x0F, 0x83, 0xE0, 0xF8,
-  0x3E, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x80, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80,
-  0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xF8, 0x7C, 0x3E,
-  0x1F, 0x0F, 0x87, 0xC7, 0x73, 0xBF, 0x8F, 0xC0, 0xE0, 0xFC, 0x1B, 0x87,
-  0x70, 0xEE, 0x39, 0xC7, 0x38, 0xC7, 0x38, 0xE7, 0x1C, 0xC3, 0xB8, 0x76,
-  0x0F, 0xC1, 0xF8, 0x3F, 0x07, 0x70, 0xEE, 0x1C, 0xC3, 0x9C, 0x73, 0x8E,
-  0x39, 0xC7, 0x38, 0x67, 0x0E, 0xE1, 0xDC, 0x1F, 0x83, 0x80, 0xE0, 0xE0,
-  0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
-  0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0, 0xFF,
-  0xFF, 0xF0, 0x0F, 0xE0, 0x3F, 0xC0, 0x7F, 0x80, 0xFF, 0x01, 0xFF, 0x03,
-  0xF6, 0x07, 0xFC, 0x1B, 0xF8, 0x37, 0xF0, 0x6F, 0xE0, 0xDF, 0x61, 0xBE,
-  0xC7, 0x7D, 0x8C, 0xFB, 0x1B, 0xF6, 0x37, 0xE6, 0x6F, 0xCC, 0xDF, 0x9B,
-  0x3F, 0x36, 0x7E, 0x6C, 0xFC, 0x79, 0xF8, 0xF3, 0xF1, 0xC7, 0xE3, 0x8F,
-  0xC7, 0x1F, 0x86, 0x38, 0xE0, 0x7C, 0x0F, 0x81, 0xF8, 0x3F, 0x07, 0xE0,
-  0xFE, 0x1F, 0xC3, 0xF8, 0x7F, 0x0F, 0xB1, 0xF6, 0x3E, 0xC7, 0xCC, 0xF9,
-  0x9F, 0x33, 0xE3, 0x7C, 0x6F, 0x8D, 0xF1, 0xFE, 0x1F, 0xC3, 0xF8, 0x7F,
-  0x07, 0xE0, 0xFC, 0x1F, 0x81, 0x80, 0x3F, 0x1F, 0xE7, 0x3B, 0x87, 0xE1,
-  0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E,
-  0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87,
-  0x73, 0x9F, 0xE3, 0xF0, 0xFF, 0x3F, 0xEE, 0x3F, 0x87, 0xE1, 0xF8, 0x7E,
-  0x0F, 0x83, 0xE0, 0xF8, 0x3E, 0x1F, 0x87, 0xE1, 0xF8, 0x7F, 0xFB, 0xFC,
-  0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38,
-  0x0E, 0x00, 0x3F, 0x1F, 0xE7, 0x3B, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87,
-  0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8,
-  0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0x73, 0x9F, 0xE3, 0xF0,
-  0x18, 0x07, 0x00, 0xE0, 0x18, 0x02, 0xFF, 0x1F, 0xF3, 0x8F, 0x70, 0xEE,
-  0x1D, 0xC1, 0xB8, 0x37, 0x06, 0xE0, 0xDC, 0x3B, 0x87, 0x70, 0xEF, 0xF9,
-  0xFF, 0x38, 0x77, 0x0E, 0xE0, 0xDC, 0x1B, 0x83, 0x70, 0x6E, 0x0D, 0xC1,
-  0xB8, 0x37, 0x06, 0xE0, 0xDC, 0x1B, 0x83, 0x80, 0x3F, 0x1F, 0xE7, 0x39,
-  0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0x71, 0xDC, 0x03, 0x80, 0xF0, 0x1E,
-  0x03, 0xC0, 0x78, 0x0E, 0xE1, 0xF8, 0x7E, 0x0F, 0x83, 0xE0, 0xD8, 0x36,
-  0x0D, 0xC7, 0x71, 0xCF, 0xE1, 0xF0, 0xFF, 0xFF, 0xC7, 0x03, 0x81, 0xC0,
-  0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38,
-  0x1C, 0x0E, 0x07, 0x03, 0x81, 0xC0, 0xE0, 0x70, 0x38, 0x1C, 0x0E, 0x07,
-  0x00, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1,
-  0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0xE1, 0xF8, 0x7E,
-  0x1F, 0x87, 0xE1, 0xF8, 0x7E, 0x1F, 0x87, 0x71, 0xDF, 0xE3, 0xF0, 0xC0,
-  0x7E, 0x06, 0xE0, 0x6E, 0x0E, 0xE0, 0xE6, 0x0E, 0x60, 0xE7, 0x0C, 0x70,
-  0xC7, 0x0C, 0x71, 0xC3, 0x1C, 0x31, 0xC3, 0x9C, 0x39, 0x83, 0x98, 0x19,
-  0x81, 0xB8, 0x1B, 0x81, 0xB8, 0x1F, 0x01, 0xF0, 0x0F, 0x00, 0xF0, 0x0F,
-  0x00, 0xF0, 0x0E, 0x00, 0xE0, 0xE0, 0xF8, 0x38, 0x3E, 0x0E, 0x0F, 0x83,
-  0x83, 0xE1, 0xE1, 0xD8, 0x78, 0x76, 0x1E, 0x1D, 0x86, 0xC7, 0x61, 0xB1,
-  0x9C, 0x6C, 0x67, 0x1B, 0x19, 0xCE, 0xC6, 0x33, 0x31, 0x8C, 0xC6, 0x63,
-  0x31, 0xB8, 0xCC, 0x6E, 0x33, 0x1B, 0x8E, 0xC6, 0xC3, 0xE1, 0xB0, 0xF8,
-  0x7C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x0F,
-  0x07, 0x03, 0x81, 0xC0, 0xE0 };
-
-const GFXglyph Antonio_Light16pt7bGlyphs[] PROGMEM = {
-  {     0,   8,  27,  11,    2,  -26 },   // 0x45 'E'
-  {    27,   8,  27,  11,    2,  -26 },   // 0x46 'F'
-  {    54,  10,  27,  14,    2,  -26 },   // 0x47 'G'
-  {    88,  10,  27,  15,    2,  -26 },   // 0x48 'H'
-  {   122,   3,  27,   8,    2,  -26 },   // 0x49 'I'
-  {   133,   9,  27,  13,    1,  -26 },   // 0x4A 'J'
-  {   164,  11,  27,  14,    2,  -26 },   // 0x4B 'K'
-  {   202,   8,  27,  10,    2,  -26 },   // 0x4C 'L'
-  {   229,  15,  27,  19,    2,  -26 },   // 0x4D 'M'
-  {   280,  11,  27,  15,    2,  -26 },   // 0x4E 'N'
-  {   318,  10,  27,  14,    2,  -26 },   // 0x4F 'O'
-  {   352,  10,  27,  13,    2,  -26 },   // 0x50 'P'
-  {   386,  10,  32,  14,    2,  -26 },   // 0x51 'Q'
-  {   426,  11,  27,  14,    2,  -26 },   // 0x52 'R'
-  {   464,  10,  27,  12,    1,  -26 },   // 0x53 'S'
-  {   498,   9,  27,   9,    0,  -26 },   // 0x54 'T'
-  {   529,  10,  27,  14,    2,  -26 },   // 0x55 'U'
-  {   563,  12,  27,  13,    1,  -26 },   // 0x56 'V'
-  {   604,  18,  27,  20,    1,  -26 } }; // 0x57 'W'
-
-const GFXfont Antonio_Light16pt7b PROGMEM = {
-  (uint8_t  *)Antonio_Light16pt7bBitmaps,
-  (GFXglyph *)Antonio_Light16pt7bGlyphs,
-  0x45, 0x57, 41 };
-
-// Approx. 805 bytes
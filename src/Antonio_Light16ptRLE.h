@@ -0,0 +1,81 @@
+// Generated by rlefontconvert from Antonio-Light.ttf, size 16, characters 69-87
+constexpr uint8_t Antonio_Light16ptRLESpans[] PROGMEM = {
+    0,   0,   8,   2,   0,   2,   3,  10,   0,  12,   8,   2,   0,  14,   3,  11,
+    0,  25,   8,   2,   0,   0,   8,   2,   0,   2,   3,   9,   0,  11,   8,   3,
+    0,  14,   3,  13,   2,   0,   6,   1,   1,   1,   8,   1,   1,   2,   3,   1,
+    6,   2,   3,   1,   7,   3,   3,   7,   5,  13,   5,   2,   0,   3,   3,  21,
+    7,  15,   3,   9,   1,  24,   3,   1,   6,  24,   4,   1,   1,  25,   9,   1,
+    2,  26,   5,   1,   8,  26,   2,   1,   0,   0,   3,  12,   8,   0,   2,  12,
+    0,  12,  10,   2,   0,  14,   3,  13,   8,  14,   2,  13,   0,   0,   3,  27,
+    7,   0,   2,  23,   0,  18,   3,   6,   6,  23,   3,   2,   1,  24,   3,   1,
+    1,  25,   7,   1,   2,  26,   6,   1,   8,   0,   3,   1,   8,   1,   2,   1,
+    7,   2,   3,   2,   6,   4,   3,   2,   6,   6,   2,   1,   5,   7,   3,   2,
+    5,   9,   2,   1,   4,  10,   3,   1,   0,   0,   3,  12,   4,  11,   2,   1,
+    0,  12,   6,   3,   4,  15,   3,   2,   5,  17,   2,   1,   5,  18,   3,   2,
+    6,  20,   3,   2,   7,  22,   2,   1,   7,  23,   3,   2,   0,  15,   3,  12,
+    8,  25,   3,   2,   0,   0,   3,  25,   0,  25,   8,   2,  12,   0,   3,   1,
+    0,   0,   4,   5,   0,   5,   5,   1,  11,   1,   4,   6,   0,   6,   2,   1,
+    3,   6,   2,   1,   0,   7,   5,   4,  10,   7,   2,   5,   9,  12,   3,   1,
+   13,   7,   2,   7,   4,  11,   2,   5,   9,  13,   2,   5,   5,  16,   2,   5,
+    8,  18,   2,   3,   6,  21,   4,   2,   6,  23,   3,   3,   0,  11,   3,  16,
+   12,  14,   3,  13,   7,  26,   2,   1,   0,   0,   3,   3,   0,   3,   4,   3,
+    0,   6,   5,   4,   4,  10,   2,   3,   5,  13,   2,   3,   9,   0,   2,  19,
+    6,  16,   2,   3,   6,  19,   5,   1,   7,  20,   4,   3,   8,  23,   3,   3,
+    0,  10,   3,  17,   9,  26,   2,   1,   2,   0,   6,   1,   1,   1,   8,   1,
+    1,   2,   3,   1,   6,   2,   3,   1,   0,   3,   3,  21,   7,   3,   3,  21,
+    1,  24,   3,   1,   6,  24,   3,   1,   1,  25,   8,   1,   2,  26,   6,   1,
+    0,   0,   8,   1,   0,   1,   9,   1,   6,   2,   4,   1,   7,   3,   3,   3,
+    8,   6,   2,   4,   0,   2,   3,  12,   7,  10,   3,   4,   0,  14,   9,   1,
+    0,  15,   8,   1,   0,  16,   3,  11,   2,   0,   6,   1,   1,   1,   8,   1,
+    1,   2,   3,   1,   6,   2,   3,   1,   0,   3,   3,  21,   7,   3,   3,  21,
+    1,  24,   3,   1,   6,  24,   3,   1,   1,  25,   8,   1,   2,  26,   6,   1,
+    5,  27,   2,   1,   5,  28,   3,   1,   6,  29,   3,   1,   7,  30,   2,   1,
+    8,  31,   1,   1,   0,   0,   8,   1,   0,   1,   9,   1,   6,   2,   4,   1,
+    7,   3,   3,   2,   8,   5,   2,   4,   0,   2,   3,  10,   7,   9,   3,   3,
+    0,  12,   9,   2,   7,  14,   3,   2,   8,  16,   2,  10,   0,  14,   3,  13,
+    8,  26,   3,   1,   2,   0,   6,   1,   1,   1,   8,   1,   1,   2,   3,   1,
+    6,   2,   3,   1,   1,   3,   2,   1,   0,   4,   3,   4,   7,   3,   3,   6,
+    1,   8,   3,   2,   2,  10,   3,   1,   2,  11,   4,   1,   3,  12,   4,   1,
+    4,  13,   4,   1,   5,  14,   4,   1,   6,  15,   3,   1,   7,  16,   3,   2,
+    0,  16,   3,   5,   8,  18,   2,   5,   1,  21,   2,   2,   1,  23,   3,   2,
+    7,  23,   3,   2,   2,  25,   7,   1,   3,  26,   5,   1,   0,   0,   9,   2,
+    3,   2,   3,  25,   0,   0,   3,  24,   7,   0,   3,  25,   1,  24,   3,   1,
+    1,  25,   8,   1,   2,  26,   6,   1,   0,   0,   2,   1,   9,   0,   3,   1,
+    9,   1,   2,   2,   0,   1,   3,   4,   8,   3,   3,   4,   1,   5,   2,   2,
+    8,   7,   2,   3,   1,   7,   3,   4,   2,  11,   2,   2,   7,  10,   3,   4,
+    2,  13,   3,   3,   7,  14,   2,   3,   3,  16,   2,   4,   6,  17,   3,   3,
+    3,  20,   5,   2,   4,  22,   4,   4,   4,  26,   3,   1,   8,   0,   3,   4,
+   16,   0,   2,   4,   0,   0,   3,   5,   7,   4,   4,   3,  15,   4,   3,   4,
+    1,   5,   2,   4,   7,   7,   2,   4,   1,   9,   3,   3,   6,  11,   3,   1,
+   10,   7,   2,   6,  15,   8,   2,   6,   2,  12,   2,   5,  14,  14,   3,   3,
+    6,  12,   2,   6,   2,  17,   3,   1,  11,  13,   2,   6,  14,  17,   2,   2,
+    2,  18,   5,   2,  11,  19,   5,   1,   3,  20,   4,   5,  12,  20,   4,   5,
+    3,  25,   3,   2,  12,  25,   3,   2 };
+
+constexpr RLEglyph Antonio_Light16ptRLEGlyphs[] PROGMEM = {
+  {     0,    5,    8,   27,   11,    2,  -26 },    // 0x45 'E'
+  {     5,    4,    8,   27,   11,    2,  -26 },    // 0x46 'F'
+  {     9,   13,   10,   27,   14,    2,  -26 },    // 0x47 'G'
+  {    22,    5,   10,   27,   15,    2,  -26 },    // 0x48 'H'
+  {    27,    1,    3,   27,    8,    2,  -26 },    // 0x49 'I'
+  {    28,    6,    9,   27,   13,    1,  -26 },    // 0x4A 'J'
+  {    34,   19,   11,   27,   14,    2,  -26 },    // 0x4B 'K'
+  {    53,    2,    8,   27,   10,    2,  -26 },    // 0x4C 'L'
+  {    55,   19,   15,   27,   19,    2,  -26 },    // 0x4D 'M'
+  {    74,   12,   11,   27,   15,    2,  -26 },    // 0x4E 'N'
+  {    86,   10,   10,   27,   14,    2,  -26 },    // 0x4F 'O'
+  {    96,   10,   10,   27,   13,    2,  -26 },    // 0x50 'P'
+  {   106,   15,   10,   32,   14,    2,  -26 },    // 0x51 'Q'
+  {   121,   12,   11,   27,   14,    2,  -26 },    // 0x52 'R'
+  {   133,   22,   10,   27,   12,    1,  -26 },    // 0x53 'S'
+  {   155,    2,    9,   27,    9,    0,  -26 },    // 0x54 'T'
+  {   157,    5,   10,   27,   14,    2,  -26 },    // 0x55 'U'
+  {   162,   17,   12,   27,   13,    1,  -26 },    // 0x56 'V'
+  {   179,   23,   18,   27,   20,    1,  -26 } };   // 0x57 'W'
+
+constexpr RLEfont Antonio_Light16ptRLE PROGMEM = {
+  Antonio_Light16ptRLESpans,
+  Antonio_Light16ptRLEGlyphs,
+  0x45, 0x57, 41, 26, 32 };
+
+// Approx. 998 bytes (202 spans)
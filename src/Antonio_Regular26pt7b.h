@@ -1,346 +0,0 @@
-const uint8_t Antonio_Regular26pt7bBitmaps[] PROGMEM = {
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xC0,
-  0x00, 0x7C, 0xE0, 0x67, 0xCE, 0x06, 0x7C, 0xE0, 0x67, 0xCF, 0x06, 0x7C,
-  0xF0, 0x67, 0xCF, 0x06, 0x7C, 0xF0, 0x67, 0xCF, 0x86, 0x7C, 0xF8, 0x67,
-  0xCF, 0x86, 0x7C, 0xF8, 0x67, 0xCF, 0xC6, 0x7C, 0xFC, 0x67, 0xCE, 0xC6,
-  0x7C, 0xEE, 0x67, 0xCE, 0xE6, 0x7C, 0xEE, 0x67, 0xCE, 0x66, 0x7C, 0xE7,
-  0x67, 0xCE, 0x76, 0x7C, 0xE3, 0x67, 0xCE, 0x36, 0x7C, 0xE3, 0xE7, 0xCE,
-  0x3E, 0x7C, 0xE1, 0xE7, 0xCE, 0x1E, 0x7C, 0xE1, 0xE7, 0xCE, 0x1E, 0x7C,
-  0xE0, 0xE7, 0xCE, 0x0E, 0x7C, 0xE0, 0xE7, 0xCE, 0x0E, 0x7C, 0xE0, 0x67,
-  0xCE, 0x06, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-  0x07, 0xC0, 0x00, 0x7C, 0xE0, 0x67, 0xCE, 0x06, 0x7C, 0xE0, 0x67, 0xCF,
-  0x06, 0x7C, 0xF0, 0x67, 0xCF, 0x06, 0x7C, 0xF0, 0x67, 0xCF, 0x86, 0x7C,
-  0xF8, 0x67, 0xCF, 0x86, 0x7C, 0xF8, 0x67, 0xCF, 0xC6, 0x7C, 0xFC, 0x67,
-  0xCE, 0xC6, 0x7C, 0xEE, 0x67, 0xCE, 0xE6, 0x7C, 0xEE, 0x67, 0xCE, 0x66,
-  0x7C, 0xE7, 0x67, 0xCE, 0x76, 0x7C, 0xE3, 0x67, 0xCE, 0x36, 0x7C, 0xE3,
-  0xE7, 0xCE, 0x3E, 0x7C, 0xE1, 0xE7, 0xCE, 0x1E, 0x7C, 0xE1, 0xE7, 0xCE,
-  0x1E, 0x7C, 0xE0, 0xE7, 0xCE, 0x0E, 0x7C, 0xE0, 0xE7, 0xCE, 0x0E, 0x7C,
-  0xE0, 0x67, 0xCE, 0x06, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFC, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0xE0, 0x67, 0xCE, 0x06, 0x7C, 0xE0,
-  0x67, 0xCF, 0x06, 0x7C, 0xF0, 0x67, 0xCF, 0x06, 0x7C, 0xF0, 0x67, 0xCF,
-  0x86, 0x7C, 0xF8, 0x67, 0xCF, 0x86, 0x7C, 0xF8, 0x67, 0xCF, 0xC6, 0x7C,
-  0xFC, 0x67, 0xCE, 0xC6, 0x7C, 0xEE, 0x67, 0xCE, 0xE6, 0x7C, 0xEE, 0x67,
-  0xCE, 0x66, 0x7C, 0xE7, 0x67, 0xCE, 0x76, 0x7C, 0xE3, 0x67, 0xCE, 0x36,
-  0x7C, 0xE3, 0xE7, 0xCE, 0x3E, 0x7C, 0xE1, 0xE7, 0xCE, 0x1E, 0x7C, 0xE1,
-  0xE7, 0xCE, 0x1E, 0x7C, 0xE0, 0xE7, 0xCE, 0x0E, 0x7C, 0xE0, 0xE7, 0xCE,
-  0x0E, 0x7C, 0xE0, 0x67, 0xCE, 0x06, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0xE0, 0x67, 0xCE, 0x06,
-  0x7C, 0xE0, 0x67, 0xCF, 0x06, 0x7C, 0xF0, 0x67, 0xCF, 0x06, 0x7C, 0xF0,
-  0x67, 0xCF, 0x86, 0x7C, 0xF8, 0x67, 0xCF, 0x86, 0x7C, 0xF8, 0x67, 0xCF,
-  0xC6, 0x7C, 0xFC, 0x67, 0xCE, 0xC6, 0x7C, 0xEE, 0x67, 0xCE, 0xE6, 0x7C,
-  0xEE, 0x67, 0xCE, 0x66, 0x7C, 0xE7, 0x67, 0xCE, 0x76, 0x7C, 0xE3, 0x67,
-  0xCE, 0x36, 0x7C, 0xE3, 0xE7, 0xCE, 0x3E, 0x7C, 0xE1, 0xE7, 0xCE, 0x1E,
-  0x7C, 0xE1, 0xE7, 0xCE, 0x1E, 0x7C, 0xE0, 0xE7, 0xCE, 0x0E, 0x7C, 0xE0,
-  0xE7, 0xCE, 0x0E, 0x7C, 0xE0, 0x67, 0xCE, 0x06, 0x7C, 0x00, 0x07, 0xC0,
-  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0xE0, 0x67,
-  0xCE, 0x06, 0x7C, 0xE0, 0x67, 0xCF, 0x06, 0x7C, 0xF0, 0x67, 0xCF, 0x06,
-  0x7C, 0xF0, 0x67, 0xCF, 0x86, 0x7C, 0xF8, 0x67, 0xCF, 0x86, 0x7C, 0xF8,
-  0x67, 0xCF, 0xC6, 0x7C, 0xFC, 0x67, 0xCE, 0xC6, 0x7C, 0xEE, 0x67, 0xCE,
-  0xE6, 0x7C, 0xEE, 0x67, 0xCE, 0x66, 0x7C, 0xE7, 0x67, 0xCE, 0x76, 0x7C,
-  0xE3, 0x67, 0xCE, 0x36, 0x7C, 0xE3, 0xE7, 0xCE, 0x3E, 0x7C, 0xE1, 0xE7,
-  0xCE, 0x1E, 0x7C, 0xE1, 0xE7, 0xCE, 0x1E, 0x7C, 0xE0, 0xE7, 0xCE, 0x0E,
-  0x7C, 0xE0, 0xE7, 0xCE, 0x0E, 0x7C, 0xE0, 0x67, 0xCE, 0x06, 0x7C, 0x00,
-  0x07, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0x7C,
-  0xE0, 0x67, 0xCE, 0x06, 0x7C, 0xE0, 0x67, 0xCF, 0x06, 0x7C, 0xF0, 0x67,
-  0xCF, 0x06, 0x7C, 0xF0, 0x67, 0xCF, 0x86, 0x7C, 0xF8, 0x67, 0xCF, 0x86,
-  0x7C, 0xF8, 0x67, 0xCF, 0xC6, 0x7C, 0xFC, 0x67, 0xCE, 0xC6, 0x7C, 0xEE,
-  0x67, 0xCE, 0xE6, 0x7C, 0xEE, 0x67, 0xCE, 0x66, 0x7C, 0xE7, 0x67, 0xCE,
-  0x76, 0x7C, 0xE3, 0x67, 0xCE, 0x36, 0x7C, 0xE3, 0xE7, 0xCE, 0x3E, 0x7C,
-  0xE1, 0xE7, 0xCE, 0x1E, 0x7C, 0xE1, 0xE7, 0xCE, 0x1E, 0x7C, 0xE0, 0xE7,
-  0xCE, 0x0E, 0x7C, 0xE0, 0xE7, 0xCE, 0x0E, 0x7C, 0xE0, 0x67, 0xCE, 0x06,
-  0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xC0,
-  0x00, 0x7C, 0xE0, 0x67, 0xCE, 0x06, 0x7C, 0xE0, 0x67, 0xCF, 0x06, 0x7C,
-  0xF0, 0x67, 0xCF, 0x06, 0x7C, 0xF0, 0x67, 0xCF, 0x86, 0x7C, 0xF8, 0x67,
-  0xCF, 0x86, 0x7C, 0xF8, 0x67, 0xCF, 0xC6, 0x7C, 0xFC, 0x67, 0xCE, 0xC6,
-  0x7C, 0xEE, 0x67, 0xCE, 0xE6, 0x7C, 0xEE, 0x67, 0xCE, 0x66, 0x7C, 0xE7,
-  0x67, 0xCE, 0x76, 0x7C, 0xE3, 0x67, 0xCE, 0x36, 0x7C, 0xE3, 0xE7, 0xCE,
-  0x3E, 0x7C, 0xE1, 0xE7, 0xCE, 0x1E, 0x7C, 0xE1, 0xE7, 0xCE, 0x1E, 0x7C,
-  0xE0, 0xE7, 0xCE, 0x0E, 0x7C, 0xE0, 0xE7, 0xCE, 0x0E, 0x7C, 0xE0, 0x67,
-  0xCE, 0x06, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-  0x07, 0xC0, 0x00, 0x7C, 0xE0, 0x67, 0xCE, 0x06, 0x7C, 0xE0, 0x67, 0xCF,
-  0x06, 0x7C, 0xF0, 0x67, 0xCF, 0x06, 0x7C, 0xF0, 0x67, 0xCF, 0x86, 0x7C,
-  0xF8, 0x67, 0xCF, 0x86, 0x7C, 0xF8, 0x67, 0xCF, 0xC6, 0x7C, 0xFC, 0x67,
-  0xCE, 0xC6, 0x7C, 0xEE, 0x67, 0xCE, 0xE6, 0x7C, 0xEE, 0x67, 0xCE, 0x66,
-  0x7C, 0xE7, 0x67, 0xCE, 0x76, 0x7C, 0xE3, 0x67, 0xCE, 0x36, 0x7C, 0xE3,
-  0xE7, 0xCE, 0x3E, 0x7C, 0xE1, 0xE7, 0xCE, 0x1E, 0x7C, 0xE1, 0xE7, 0xCE,
-  0x1E, 0x7C, 0xE0, 0xE7, 0xCE, 0x0E, 0x7C, 0xE0, 0xE7, 0xCE, 0x0E, 0x7C,
-  0xE0, 0x67, 0xCE, 0x06, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFC, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0xE0, 0x67, 0xCE, 0x06, 0x7C, 0xE0,
-  0x67, 0xCF, 0x06, 0x7C, 0xF0, 0x67, 0xCF, 0x06, 0x7C, 0xF0, 0x67, 0xCF,
-  0x86, 0x7C, 0xF8, 0x67, 0xCF, 0x86, 0x7C, 0xF8, 0x67, 0xCF, 0xC6, 0x7C,
-  0xFC, 0x67, 0xCE, 0xC6, 0x7C, 0xEE, 0x67, 0xCE, 0xE6, 0x7C, 0xEE, 0x67,
-  0xCE, 0x66, 0x7C, 0xE7, 0x67, 0xCE, 0x76, 0x7C, 0xE3, 0x67, 0xCE, 0x36,
-  0x7C, 0xE3, 0xE7, 0xCE, 0x3E, 0x7C, 0xE1, 0xE7, 0xCE, 0x1E, 0x7C, 0xE1,
-  0xE7, 0xCE, 0x1E, 0x7C, 0xE0, 0xE7, 0xCE, 0x0E, 0x7C, 0xE0, 0xE7, 0xCE,
-  0x0E, 0x7C, 0xE0, 0x67, 0xCE, 0x06, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0xE0, 0x67, 0xCE, 0x06,
-  0x7C, 0xE0, 0x67, 0xCF, 0x06, 0x7C, 0xF0, 0x67, 0xCF, 0x06, 0x7C, 0xF0,
-  0x67, 0xCF, 0x86, 0x7C, 0xF8, 0x67, 0xCF, 0x86, 0x7C, 0xF8, 0x67, 0xCF,
-  0xC6, 0x7C, 0xFC, 0x67, 0xCE, 0xC6, 0x7C, 0xEE, 0x67, 0xCE, 0xE6, 0x7C,
-  0xEE, 0x67, 0xCE, 0x66, 0x7C, 0xE7, 0x67, 0xCE, 0x76, 0x7C, 0xE3, 0x67,
-  0xCE, 0x36, 0x7C, 0xE3, 0xE7, 0xCE, 0x3E, 0x7C, 0xE1, 0xE7, 0xCE, 0x1E,
-  0x7C, 0xE1, 0xE7, 0xCE, 0x1E, 0x7C, 0xE0, 0xE7, 0xCE, 0x0E, 0x7C, 0xE0,
-  0xE7, 0xCE, 0x0E, 0x7C, 0xE0, 0x67, 0xCE, 0x06, 0x7C, 0x00, 0x07, 0xC0,
-  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0xE0, 0x67,
-  0xCE, 0x06, 0x7C, 0xE0, 0x67, 0xCF, 0x06, 0x7C, 0xF0, 0x67, 0xCF, 0x06,
-  0x7C, 0xF0, 0x67, 0xCF, 0x86, 0x7C, 0xF8, 0x67, 0xCF, 0x86, 0x7C, 0xF8,
-  0x67, 0xCF, 0xC6, 0x7C, 0xFC, 0x67, 0xCE, 0xC6, 0x7C, 0xEE, 0x67, 0xCE,
-  0xE6, 0x7C, 0xEE, 0x67, 0xCE, 0x66, 0x7C, 0xE7, 0x67, 0xCE, 0x76, 0x7C,
-  0xE3, 0x67, 0xCE, 0x36, 0x7C, 0xE3, 0xE7, 0xCE, 0x3E, 0x7C, 0xE1, 0xE7,
-  0xCE, 0x1E, 0x7C, 0xE1, 0xE7, 0xCE, 0x1E, 0x7C, 0xE0, 0xE7, 0xCE, 0x0E,
-  0x7C, 0xE0, 0xE7, 0xCE, 0x0E, 0x7C, 0xE0, 0x67, 0xCE, 0x06, 0x7C, 0x00,
-  0x07, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0x7C,
-  0xE0, 0x67, 0xCE, 0x06, 0x7C, 0xE0, 0x67, 0xCF, 0x06, 0x7C, 0xF0, 0x67,
-  0xCF, 0x06, 0x7C, 0xF0, 0x67, 0xCF, 0x86, 0x7C, 0xF8, 0x67, 0xCF, 0x86,
-  0x7C, 0xF8, 0x67, 0xCF, 0xC6, 0x7C, 0xFC, 0x67, 0xCE, 0xC6, 0x7C, 0xEE,
-  0x67, 0xCE, 0xE6, 0x7C, 0xEE, 0x67, 0xCE, 0x66, 0x7C, 0xE7, 0x67, 0xCE,
-  0x76, 0x7C, 0xE3, 0x67, 0xCE, 0x36, 0x7C, 0xE3, 0xE7, 0xCE, 0x3E, 0x7C,
-  0xE1, 0xE7, 0xCE, 0x1E, 0x7C, 0xE1, 0xE7, 0xCE, 0x1E, 0x7C, 0xE0, 0xE7,
-  0xCE, 0x0E, 0x7C, 0xE0, 0xE7, 0xCE, 0x0E, 0x7C, 0xE0, 0x67, 0xCE, 0x06,
-  0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xC0,
-  0x00, 0x7C, 0xE0, 0x67, 0xCE, 0x06, 0x7C, 0xE0, 0x67, 0xCF, 0x06, 0x7C,
-  0xF0, 0x67, 0xCF, 0x06, 0x7C, 0xF0, 0x67, 0xCF, 0x86, 0x7C, 0xF8, 0x67,
-  0xCF, 0x86, 0x7C, 0xF8, 0x67, 0xCF, 0xC6, 0x7C, 0xFC, 0x67, 0xCE, 0xC6,
-  0x7C, 0xEE, 0x67, 0xCE, 0xE6, 0x7C, 0xEE, 0x67, 0xCE, 0x66, 0x7C, 0xE7,
-  0x67, 0xCE, 0x76, 0x7C, 0xE3, 0x67, 0xCE, 0x36, 0x7C, 0xE3, 0xE7, 0xCE,
-  0x3E, 0x7C, 0xE1, 0xE7, 0xCE, 0x1E, 0x7C, 0xE1, 0xE7, 0xCE, 0x1E, 0x7C,
-  0xE0, 0xE7, 0xCE, 0x0E, 0x7C, 0xE0, 0xE7, 0xCE, 0x0E, 0x7C, 0xE0, 0x67,
-  0xCE, 0x06, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-  0x07, 0xC0, 0x00, 0x7C, 0xE0, 0x67, 0xCE, 0x06, 0x7C, 0xE0, 0x67, 0xCF,
-  0x06, 0x7C, 0xF0, 0x67, 0xCF, 0x06, 0x7C, 0xF0, 0x67, 0xCF, 0x86, 0x7C,
-  0xF8, 0x67, 0xCF, 0x86, 0x7C, 0xF8, 0x67, 0xCF, 0xC6, 0x7C, 0xFC, 0x67,
-  0xCE, 0xC6, 0x7C, 0xEE, 0x67, 0xCE, 0xE6, 0x7C, 0xEE, 0x67, 0xCE, 0x66,
-  0x7C, 0xE7, 0x67, 0xCE, 0x76, 0x7C, 0xE3, 0x67, 0xCE, 0x36, 0x7C, 0xE3,
-  0xE7, 0xCE, 0x3E, 0x7C, 0xE1, 0xE7, 0xCE, 0x1E, 0x7C, 0xE1, 0xE7, 0xCE,
-  0x1E, 0x7C, 0xE0, 0xE7, 0xCE, 0x0E, 0x7C, 0xE0, 0xE7, 0xCE, 0x0E, 0x7C,
-  0xE0, 0x67, 0xCE, 0x06, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7F, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFC, 0x00, 0x07, 0xC0, 0x00, 0x7C, 0xE0, 0x67, 0xCE, 0x06, 0x7C, 0xE0,
-  0x67, 0xCF, 0x06, 0x7C, 0xF0, 0x67, 0xCF, 0x06, 0x7C, 0xF0, 0x67, 0xCF,
-  0x86, 0x7C, 0xF8, 0x67, 0xCF, 0x86, 0x7C, 0xF8, 0x67, 0xCF, 0xC6, 0x7C,
-  0xFC, 0x67, 0xCE, 0xC6, 0x7C, 0xEE, 0x67, 0xCE, 0xE6, 0x7C, 0xEE, 0x67,
-  0xCE, 0x66, 0x7C, 0xE7, 0x67, 0xCE, 0x76, 0x7C, 0xE3, 0x67, 0xCE, 0x36,
-  0x7C, 0xE3, 0xE7, 0xCE, 0x3E, 0x7C, 0xE1, 0xE7, 0xCE, 0x1E, 0x7C, 0xE1,
-  0xE7, 0xCE, 0x1E, 0x7C, 0xE0, 0xE7, 0xCE, 0x0E, 0x7C, 0xE0, 0xE7, 0xCE,
-  0x0E, 0x7C, 0xE0, 0x67, 0xCE, 0x06, 0x7C, 0x00, 0x07, 0xC0, 0x00, 0x7F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xF0, 0x7F, 0xF1, 0xFF,
-  0xF3, 0xFF, 0xE7, 0xC7, 0xFF, 0x07, 0xFE, 0x0F, 0xFC, 0x1F, 0xF8, 0x3F,
-  0xF0, 0x7F, 0xE0, 0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0x07, 0xFE, 0x0F, 0xFC,
-  0x1F, 0xF8, 0x3F, 0xF0, 0x7F, 0xE0, 0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0x07,
-  0xFE, 0x0F, 0xFC, 0x1F, 0xF8, 0x3F, 0xF0, 0x7F, 0xE0, 0xFF, 0xC1, 0xFF,
-  0x83, 0xFF, 0x07, 0xFE, 0x0F, 0xFC, 0x1F, 0xF8, 0x3F, 0xF0, 0x7F, 0xE0,
-  0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0x07, 0xFE, 0x0F, 0xBE, 0x3F, 0x7F, 0xFC,
-  0xFF, 0xF8, 0xFF, 0xE0, 0xFF, 0x80, 0x18, 0x00, 0x00, 0xF0, 0x0F, 0x01,
-  0xF0, 0x7F, 0x0F, 0xF7, 0xFF, 0xFF, 0xFF, 0xDF, 0xF9, 0xF8, 0x1F, 0x01,
-  0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01,
-  0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01,
-  0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01,
-  0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01, 0xF0, 0x1F, 0x01,
-  0xF0, 0x1F, 0x0F, 0xF0, 0x1F, 0xF8, 0x3F, 0xFC, 0x7F, 0xFC, 0x7C, 0x7E,
-  0x7C, 0x3E, 0x78, 0x3E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1E, 0xF8, 0x1F,
-  0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1E, 0xF8, 0x3E, 0xF8, 0x3E,
-  0x00, 0x3E, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xFC, 0x00, 0xF8,
-  0x01, 0xF8, 0x03, 0xF0, 0x03, 0xE0, 0x07, 0xE0, 0x07, 0xC0, 0x0F, 0xC0,
-  0x0F, 0x80, 0x1F, 0x80, 0x1F, 0x00, 0x3F, 0x00, 0x3E, 0x00, 0x7E, 0x00,
-  0x7C, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0xFC, 0x00, 0xF8, 0x00, 0xFF, 0xFE,
-  0xFF, 0xFE, 0xFF, 0xFE, 0xFF, 0xFE, 0x0F, 0xF0, 0x3F, 0xF8, 0x7F, 0xFC,
-  0x7F, 0xFE, 0x7C, 0x7E, 0xFC, 0x3E, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
-  0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F,
-  0x00, 0x1F, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0x7E, 0x03, 0xFC, 0x03, 0xF8,
-  0x03, 0xF8, 0x03, 0xFC, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x3E, 0x00, 0x1F,
-  0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
-  0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x3E,
-  0xFC, 0x3E, 0x7F, 0xFE, 0x7F, 0xFC, 0x3F, 0xF8, 0x1F, 0xF0, 0x01, 0x00,
-  0x00, 0x3E, 0x00, 0x0F, 0xC0, 0x01, 0xF8, 0x00, 0x3F, 0x00, 0x0F, 0xE0,
-  0x01, 0xFC, 0x00, 0x3F, 0x80, 0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0,
-  0x07, 0xF8, 0x01, 0xFF, 0x00, 0x3B, 0xE0, 0x07, 0x7C, 0x01, 0xEF, 0x80,
-  0x3D, 0xF0, 0x07, 0x3E, 0x01, 0xE7, 0xC0, 0x3C, 0xF8, 0x07, 0x9F, 0x00,
-  0xE3, 0xE0, 0x3C, 0x7C, 0x07, 0x8F, 0x80, 0xE1, 0xF0, 0x3C, 0x3E, 0x07,
-  0x87, 0xC0, 0xF0, 0xF8, 0x3C, 0x1F, 0x07, 0x83, 0xE0, 0xF0, 0x7C, 0x3E,
-  0x0F, 0x87, 0x81, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xF0, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00,
-  0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0xFF, 0xFD, 0xFF,
-  0xFB, 0xFF, 0xF7, 0xFF, 0xEF, 0xFF, 0xDF, 0x00, 0x3E, 0x00, 0x7C, 0x00,
-  0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x18, 0x3F,
-  0xFC, 0x7F, 0xFC, 0xFF, 0xF9, 0xFF, 0xFB, 0xE1, 0xF7, 0xC3, 0xEF, 0x83,
-  0xDE, 0x07, 0xC0, 0x0F, 0x80, 0x1F, 0x00, 0x3E, 0x00, 0x7C, 0x00, 0xF8,
-  0x01, 0xF0, 0x03, 0xE0, 0x07, 0xC0, 0x0F, 0xFC, 0x1F, 0xF8, 0x3F, 0xF0,
-  0x7F, 0xE0, 0xFF, 0xC1, 0xFF, 0x83, 0xFF, 0x07, 0xBE, 0x0F, 0x7C, 0x3E,
-  0xFF, 0xFC, 0xFF, 0xF0, 0xFF, 0xE0, 0xFF, 0x00, 0x10, 0x00, 0x0F, 0xF0,
-  0x1F, 0xF8, 0x3F, 0xFC, 0x7F, 0xFE, 0x7C, 0x3E, 0x7C, 0x3E, 0x78, 0x1E,
-  0xF8, 0x1E, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
-  0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0xFB, 0xF8, 0xFF, 0xFC,
-  0xFF, 0xFE, 0xFF, 0xFE, 0xFC, 0x3E, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F,
-  0xF8, 0x1F, 0xF8, 0x0F, 0xF8, 0x0F, 0xF8, 0x0F, 0xF8, 0x0F, 0xF8, 0x0F,
-  0xF8, 0x0F, 0xF8, 0x0F, 0xF8, 0x0F, 0xF8, 0x0F, 0xF8, 0x1F, 0xF8, 0x1F,
-  0xF8, 0x1F, 0x7C, 0x1F, 0x7C, 0x3F, 0x7F, 0xFE, 0x3F, 0xFE, 0x1F, 0xFC,
-  0x0F, 0xF8, 0x01, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0x07, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x7C, 0x00, 0x1F,
-  0x00, 0x07, 0xC0, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x1F, 0x00,
-  0x07, 0xC0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x03,
-  0xE0, 0x01, 0xF0, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x03, 0xF0,
-  0x00, 0xF8, 0x00, 0x3E, 0x00, 0x0F, 0x80, 0x07, 0xE0, 0x01, 0xF0, 0x00,
-  0x7C, 0x00, 0x1F, 0x00, 0x07, 0xC0, 0x03, 0xF0, 0x00, 0xFC, 0x00, 0x3E,
-  0x00, 0x0F, 0x80, 0x03, 0xE0, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x1F, 0x80,
-  0x07, 0xE0, 0x01, 0xF8, 0x00, 0x7E, 0x00, 0x07, 0xF8, 0x0F, 0xFF, 0x0F,
-  0xFF, 0x87, 0xFF, 0xE7, 0xE1, 0xF3, 0xE0, 0xF9, 0xF0, 0x3E, 0xF8, 0x1F,
-  0x7C, 0x0F, 0xBE, 0x07, 0xDF, 0x03, 0xEF, 0x81, 0xF7, 0xC0, 0xFB, 0xE0,
-  0x7D, 0xF0, 0x3E, 0xF8, 0x1E, 0x7C, 0x1F, 0x1E, 0x0F, 0x8F, 0x8F, 0x83,
-  0xFF, 0xC0, 0xFF, 0xC0, 0xFF, 0xF0, 0xFF, 0xF8, 0x7C, 0x7E, 0x7E, 0x1F,
-  0x3E, 0x0F, 0x9F, 0x03, 0xCF, 0x81, 0xFF, 0xC0, 0xFF, 0xE0, 0x7F, 0xE0,
-  0x3F, 0xF0, 0x1F, 0xF8, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0xFF, 0x81, 0xFF,
-  0xC0, 0xFB, 0xE0, 0x7D, 0xF0, 0x7C, 0xFC, 0x3E, 0x3F, 0xFF, 0x1F, 0xFF,
-  0x07, 0xFF, 0x01, 0xFF, 0x00, 0x08, 0x00, 0x1F, 0xF0, 0x3F, 0xF8, 0x7F,
-  0xFC, 0x7F, 0xFC, 0xFC, 0x7E, 0xF8, 0x3E, 0xF8, 0x3E, 0xF0, 0x1E, 0xF0,
-  0x1F, 0xF0, 0x1F, 0xF0, 0x1F, 0xF0, 0x1F, 0xF0, 0x1F, 0xF0, 0x1F, 0xF0,
-  0x1F, 0xF0, 0x1F, 0xF0, 0x1F, 0xF0, 0x1F, 0xF0, 0x1F, 0xF0, 0x1F, 0xF0,
-  0x1F, 0xF8, 0x1F, 0xF8, 0x3F, 0x7F, 0xFF, 0x7F, 0xFF, 0x3F, 0xFF, 0x1F,
-  0xDF, 0x02, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0xF8, 0x1F, 0xF8,
-  0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1F, 0xF8, 0x1E, 0xF8, 0x1E, 0x78,
-  0x3E, 0x7C, 0x3E, 0x7F, 0xFE, 0x3F, 0xFC, 0x3F, 0xF8, 0x1F, 0xF0, 0x01,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1E, 0x00,
-  0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xC7, 0xFC,
-  0x07, 0xFF, 0xFC, 0x00, 0x0F, 0xDE, 0x00, 0x00, 0x71, 0x00, 0x00, 0x06,
-  0x00, 0x3F, 0x80, 0x00, 0x3F, 0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0x07, 0xFF,
-  0xFF, 0x00, 0x3C, 0x07, 0xC0, 0x06, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xF8, 0x00, 0x00, 0xFE,
-  0x00, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x1C, 0x00, 0x00,
-  0x01, 0x00, 0x00, 0x40, 0x0F, 0x00, 0x0E, 0x3F, 0xFF, 0x80, 0xF1, 0xFF,
-  0xFE, 0x07, 0x8F, 0xFF, 0xF8, 0x7C, 0x40, 0x7F, 0xFF, 0xE0, 0x00, 0x7E,
-  0x7F, 0x00, 0x01, 0xC2, 0x78, 0x00, 0x04, 0x03, 0xCF, 0xC0, 0x00, 0x1E,
-  0x3F, 0x00, 0x07, 0xF1, 0xFC, 0x00, 0x7F, 0x8F, 0xE0, 0x03, 0xFC, 0x3C,
-  0x00, 0x31, 0xE0, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00,
-  0x3F, 0xC0, 0x00, 0x07, 0xFE, 0x00, 0x00, 0x3F, 0xF0, 0x00, 0x01, 0xFF,
-  0x80, 0x00, 0x0F, 0x3C, 0x00, 0x00, 0xE1, 0xE0, 0x00, 0x04, 0x0C, 0x00,
-  0x00, 0x0C, 0x00, 0x00, 0x0F, 0x00, 0x00, 0x0F, 0xC0, 0x00, 0x1F, 0xF0,
-  0x00, 0x1F, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x1F, 0xFF, 0xC0, 0x1F, 0x00,
-  0xF0, 0x1E, 0x00, 0x1C, 0x1C, 0x3F, 0x87, 0xBF, 0x3F, 0xF3, 0xE1, 0xF8,
-  0x3F, 0x80, 0xF0, 0x07, 0xC0, 0x7C, 0xF3, 0xE0, 0x3F, 0xFF, 0xF0, 0x1F,
-  0xE7, 0xF8, 0x0F, 0xE1, 0xFC, 0x07, 0xE0, 0xFE, 0x03, 0xF8, 0xFF, 0x01,
-  0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xC0, 0x40, 0x00, 0x00, 0x1C, 0x00, 0x00,
-  0x01, 0xC0, 0x18, 0x00, 0x1C, 0x07, 0x80, 0x01, 0xC1, 0xF8, 0x00, 0x1C,
-  0x7F, 0x80, 0x01, 0xC7, 0xF8, 0x00, 0x1C, 0x7F, 0x80, 0x03, 0xC7, 0xF8,
-  0x00, 0xFC, 0x7F, 0x80, 0x3F, 0xC7, 0xF8, 0x0F, 0xFC, 0x7F, 0xC7, 0xFF,
-  0xC7, 0xFC, 0x0F, 0xFC, 0x7C, 0x01, 0xFF, 0xC7, 0x80, 0x3F, 0xFC, 0x70,
-  0x07, 0xE1, 0xC6, 0x00, 0xFC, 0x1C, 0x40, 0x1F, 0x83, 0xC0, 0x03, 0xF0,
-  0x7C, 0x00, 0x7E, 0x0F, 0xC0, 0x0F, 0xC1, 0xFC, 0x01, 0xF8, 0x3F, 0xC0,
-  0x00, 0x00, 0x1C, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x1C, 0x00, 0x00,
-  0x02, 0x00, 0x06, 0x00, 0x18, 0x07, 0x00, 0x1E, 0x0F, 0x07, 0x07, 0x8F,
-  0x1F, 0xF9, 0xEF, 0x3F, 0xFE, 0x7B, 0x3E, 0x07, 0xCD, 0x3C, 0x00, 0xF4,
-  0x38, 0x30, 0x38, 0x18, 0x18, 0x0E, 0x1C, 0x0C, 0x07, 0x0C, 0x06, 0x01,
-  0xCE, 0x03, 0x00, 0xE7, 0x01, 0x80, 0x73, 0x80, 0xC0, 0x19, 0xC0, 0x70,
-  0x0C, 0xE0, 0x1E, 0x0E, 0x70, 0x03, 0x87, 0x1C, 0x00, 0xE3, 0x8E, 0x00,
-  0x13, 0x83, 0x80, 0x01, 0xC1, 0xE0, 0x01, 0xC0, 0x78, 0x03, 0xC0, 0x1F,
-  0x87, 0xC0, 0x07, 0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0x23, 0x00, 0x0C,
-  0x38, 0x60, 0x07, 0x87, 0x00, 0x60, 0xF0, 0xE1, 0xFF, 0x9E, 0x7C, 0x3F,
-  0xF3, 0xCF, 0x80, 0x1F, 0x32, 0x70, 0x01, 0xC8, 0x3E, 0x00, 0x38, 0x1D,
-  0xC0, 0x07, 0x07, 0x38, 0x01, 0xC1, 0x87, 0x00, 0x38, 0xE0, 0xE0, 0x0E,
-  0x38, 0x1C, 0x03, 0x8E, 0x03, 0x80, 0x63, 0x80, 0x70, 0x18, 0xE0, 0x0E,
-  0x0E, 0x38, 0x01, 0xC3, 0x87, 0x00, 0x38, 0x61, 0xC0, 0x07, 0x10, 0x38,
-  0x00, 0xE0, 0x0F, 0x00, 0x1C, 0x01, 0xE0, 0x0F, 0x80, 0x3F, 0x0F, 0xF0,
-  0x07, 0xFF, 0xCF, 0x00, 0x7F, 0xC1, 0x80, 0x00, 0x00, 0x60, 0x00, 0x00,
-  0x3C, 0x02, 0x00, 0x0F, 0x83, 0x81, 0xC1, 0xF3, 0xC7, 0xFE, 0x73, 0xCF,
-  0xFF, 0x8B, 0xCF, 0x01, 0xF0, 0xCF, 0x00, 0x38, 0x2E, 0x04, 0x0E, 0x0E,
-  0x0C, 0x03, 0x87, 0x03, 0x01, 0xC3, 0x01, 0x80, 0x73, 0x80, 0xC0, 0x39,
-  0xC0, 0x60, 0x1C, 0xE0, 0x30, 0x06, 0x70, 0x1E, 0x07, 0x38, 0x07, 0xC3,
-  0x9C, 0x00, 0x79, 0xC7, 0x00, 0x08, 0xE3, 0x80, 0x00, 0xE0, 0xE0, 0x00,
-  0x70, 0x78, 0x00, 0x70, 0x1E, 0x00, 0xF0, 0x07, 0xE1, 0xF0, 0x01, 0xFF,
-  0xF0, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07,
-  0xC0, 0x00, 0x0F, 0xC0, 0x02, 0x0F, 0x87, 0x03, 0x87, 0x1F, 0xF8, 0xE1,
-  0x3F, 0xFE, 0x78, 0x3C, 0x07, 0xDE, 0x3C, 0x00, 0xE7, 0x38, 0x10, 0x39,
-  0x38, 0x0C, 0x0E, 0x1C, 0x06, 0x07, 0x0C, 0x03, 0x01, 0xCE, 0x01, 0x80,
-  0xE7, 0x00, 0xC0, 0x73, 0x80, 0xC0, 0x19, 0xC0, 0x70, 0x0C, 0xE0, 0x1C,
-  0x0E, 0x30, 0x07, 0x07, 0x1C, 0x01, 0xC3, 0x8E, 0x00, 0x73, 0x83, 0x80,
-  0x11, 0xC1, 0xE0, 0x01, 0xC0, 0x78, 0x03, 0xC0, 0x1F, 0x87, 0xC0, 0x07,
-  0xFF, 0xC0, 0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x18,
-  0x07, 0x00, 0x1E, 0x0F, 0x07, 0x07, 0x8F, 0x1F, 0xF9, 0xEF, 0x3F, 0xFE,
-  0x7B, 0x3E, 0x07, 0xCD, 0x3C, 0x00, 0xE4, 0x38, 0x00, 0x38, 0x38, 0x00,
-  0x0E, 0x1C, 0x3F, 0xC7, 0x0C, 0x1F, 0xE1, 0xCE, 0x00, 0xE0, 0xE7, 0x00,
-  0xE0, 0x73, 0x80, 0x60, 0x19, 0xC0, 0x70, 0x0C, 0xE0, 0x70, 0x0E, 0x70,
-  0x7F, 0x87, 0x1C, 0x3F, 0xC3, 0x8E, 0x1F, 0xE3, 0x83, 0x80, 0x01, 0xC1,
-  0xE0, 0x01, 0xC0, 0x78, 0x03, 0xC0, 0x1F, 0x87, 0xC0, 0x07, 0xFF, 0xC0,
-  0x00, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x0F, 0xFC, 0x00,
-  0x00, 0xFD, 0xF8, 0x00, 0x0F, 0x01, 0xC0, 0x00, 0xF0, 0x07, 0x00, 0x07,
-  0x0C, 0x1C, 0x00, 0x30, 0x60, 0xE0, 0x03, 0x83, 0x07, 0x00, 0x1C, 0x18,
-  0x18, 0x00, 0xE0, 0xE0, 0xF0, 0x07, 0x03, 0xCF, 0x80, 0x18, 0x04, 0x7C,
-  0x00, 0xE0, 0x07, 0x63, 0xE3, 0x80, 0x3B, 0x3F, 0x9E, 0x07, 0x99, 0xFC,
-  0xFF, 0xFC, 0xCF, 0xE7, 0xFF, 0xF6, 0x7F, 0x3F, 0xFF, 0xB3, 0xF9, 0xFF,
-  0xFD, 0x8F, 0x8F, 0xFF, 0xEC, 0x00, 0x7F, 0xFF, 0x60, 0x03, 0xFF, 0xFB,
-  0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xF6, 0x00,
-  0x00, 0x03, 0xB0, 0x00, 0x00, 0x1D, 0x80, 0x00, 0x00, 0xEC, 0x00, 0x00,
-  0x07, 0x00, 0x60, 0x03, 0x01, 0xE0, 0x27, 0x81, 0xE0, 0xCF, 0x81, 0xE3,
-  0x87, 0x81, 0xE3, 0x07, 0x81, 0xE2, 0x07, 0x81, 0xE0, 0x87, 0x7F, 0xE1,
-  0x86, 0xFF, 0xE3, 0x8F, 0xFF, 0xE3, 0x1F, 0xFF, 0xE2, 0x1F, 0xFF, 0xE2,
-  0x3F, 0xFF, 0xE0, 0xFF, 0xFF, 0xE1, 0xFF, 0xFD, 0xE3, 0x81, 0xF9, 0xE2,
-  0x01, 0xF1, 0xE4, 0x01, 0xE1, 0xE0, 0x01, 0xC1, 0xE0, 0x01, 0x8F, 0xE0,
-  0x01, 0x3D, 0xE0, 0x00, 0x71, 0xC0, 0x00, 0x01, 0x00, 0x00, 0x1E, 0x00,
-  0x00, 0x0F, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0x07,
-  0xFC, 0x07, 0xFE, 0x7F, 0x00, 0x03, 0xF1, 0xE0, 0x00, 0x07, 0x04, 0x00,
-  0x00, 0x18, 0x00, 0x3F, 0x80, 0x00, 0x0F, 0xFF, 0x80, 0x01, 0xFF, 0xFF,
-  0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x3C, 0x06, 0x00, 0x01, 0x80, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x3E, 0x07, 0x80, 0x03,
-  0xE3, 0xFF, 0x80, 0x0F, 0x1F, 0xFE, 0x00, 0x38, 0xF1, 0xE0, 0x00, 0xC3,
-  0x8E, 0x00, 0x06, 0x1C, 0x70, 0x00, 0x11, 0xF7, 0xE0, 0x00, 0x0F, 0xFE,
-  0x00, 0x00, 0x3F, 0xF0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x01, 0xC0 };
-
-const GFXglyph Antonio_Regular26pt7bGlyphs[] PROGMEM = {
-  {     0,   1,   1,  21,    0,    0 },   // 0x20 ' '
-  {     1,  20,  44,  26,    3,  -43 },   // 0x21 '!'
-  {   111,  20,  44,  26,    3,  -43 },   // 0x22 '"'
-  {   221,  20,  44,  26,    3,  -43 },   // 0x23 '#'
-  {   331,  20,  44,  26,    3,  -43 },   // 0x24 '$'
-  {   441,  20,  44,  26,    3,  -43 },   // 0x25 '%'
-  {   551,  20,  44,  26,    3,  -43 },   // 0x26 '&'
-  {   661,  20,  44,  26,    3,  -43 },   // 0x27 '''
-  {   771,  20,  44,  26,    3,  -43 },   // 0x28 '('
-  {   881,  20,  44,  26,    3,  -43 },   // 0x29 ')'
-  {   991,  20,  44,  26,    3,  -43 },   // 0x2A '*'
-  {  1101,  20,  44,  26,    3,  -43 },   // 0x2B '+'
-  {  1211,  20,  44,  26,    3,  -43 },   // 0x2C ','
-  {  1321,  20,  44,  26,    3,  -43 },   // 0x2D '-'
-  {  1431,  20,  44,  26,    3,  -43 },   // 0x2E '.'
-  {  1541,  20,  44,  26,    3,  -43 },   // 0x2F '/'
-  {  1651,  15,  45,  21,    3,  -43 },   // 0x30 '0'
-  {  1736,  12,  44,  21,    3,  -43 },   // 0x31 '1'
-  {  1802,  16,  44,  21,    4,  -43 },   // 0x32 '2'
-  {  1890,  16,  45,  21,    3,  -43 },   // 0x33 '3'
-  {  1980,  19,  44,  21,    2,  -43 },   // 0x34 '4'
-  {  2085,  15,  45,  21,    4,  -43 },   // 0x35 '5'
-  {  2170,  16,  45,  21,    3,  -43 },   // 0x36 '6'
-  {  2260,  18,  44,  21,    2,  -43 },   // 0x37 '7'
-  {  2359,  17,  45,  21,    2,  -43 },   // 0x38 '8'
-  {  2455,  16,  45,  21,    3,  -43 },   // 0x39 '9'
-  {  2545,   6,  26,  12,    3,  -32 },   // 0x3A ':'
-  {  2565,  27,  23,  21,   -3,  -30 },   // 0x3B ';'
-  {  2643,  28,  23,  21,   -3,  -30 },   // 0x3C '<'
-  {  2724,  25,  21,  21,   -2,  -29 },   // 0x3D '='
-  {  2790,  27,  27,  21,   -3,  -31 },   // 0x3E '>'
-  {  2882,  25,  25,  21,   -2,  -32 },   // 0x3F '?'
-  {  2961,  26,  25,  21,   -3,  -32 },   // 0x40 '@'
-  {  3043,  25,  27,  21,   -3,  -33 },   // 0x41 'A'
-  {  3128,  25,  27,  21,   -1,  -33 },   // 0x42 'B'
-  {  3213,  25,  25,  21,   -2,  -32 },   // 0x43 'C'
-  {  3292,  29,  29,  21,   -4,  -34 },   // 0x44 'D'
-  {  3398,  23,  23,  21,   -1,  -30 },   // 0x45 'E'
-  {  3465,  29,  27,  21,   -3,  -30 } }; // 0x46 'F'
-
-const GFXfont Antonio_Regular26pt7b PROGMEM = {
-  (uint8_t  *)Antonio_Regular26pt7bBitmaps,
-  (GFXglyph *)Antonio_Regular26pt7bGlyphs,
-  0x20, 0x46, 66 };
-
-// Approx. 3843 bytes
@@ -0,0 +1,237 @@
+// Generated by rlefontconvert from Antonio-Regular.ttf, size 26, characters 32,48-70
+constexpr uint8_t Antonio_Regular26ptRLESpans[] PROGMEM = {
+    3,   0,   9,   1,   2,   1,  11,   1,   1,   2,  13,   2,   1,   4,   5,   1,
+    9,   4,   6,   1,   0,   5,   5,  34,  10,   5,   5,  34,   1,  39,   5,   1,
+    9,  39,   6,   1,   1,  40,  13,   2,   2,  42,  11,   1,   3,  43,   9,   1,
+    7,  44,   2,   1,   8,   0,   4,   2,   7,   2,   5,   1,   5,   3,   7,   1,
+    4,   4,   8,   1,   1,   5,  11,   1,   0,   6,  12,   1,   0,   7,   6,   1,
+    0,   8,   5,   1,   0,   9,   1,   1,   7,   7,   5,  37,   4,   0,   8,   1,
+    3,   1,  10,   1,   2,   2,  12,   1,   1,   3,  13,   1,   9,   4,   6,   1,
+    1,   4,   5,   2,  10,   5,   5,   2,   1,   6,   4,   1,  11,   7,   4,   3,
+   11,  10,   5,   4,  11,  14,   4,   1,   0,   7,   5,  10,  10,  15,   5,   4,
+    9,  19,   5,   2,   8,  21,   6,   1,   8,  22,   5,   1,   7,  23,   6,   1,
+    6,  24,   6,   1,   6,  25,   5,   1,   5,  26,   6,   1,   5,  27,   5,   1,
+    4,  28,   6,   1,   4,  29,   5,   1,   3,  30,   6,   1,   3,  31,   5,   1,
+    2,  32,   6,   1,   2,  33,   5,   1,   1,  34,   6,   1,   1,  35,   5,   3,
+    0,  38,   6,   1,   0,  39,   5,   1,   0,  40,  15,   4,   4,   0,   8,   1,
+    2,   1,  11,   1,   1,   2,  13,   1,   1,   3,  14,   1,   1,   4,   5,   1,
+    9,   4,   6,   1,   0,   5,   6,   1,  10,   5,   5,   1,   0,   6,   5,   6,
+   11,   6,   5,  10,  11,  16,   4,   1,  10,  17,   5,   1,   9,  18,   6,   1,
+    6,  19,   8,   1,   6,  20,   7,   2,   6,  22,   8,   1,   9,  23,   5,   1,
+   10,  24,   5,   2,  11,  26,   5,  12,   0,  30,   5,   9,  10,  38,   5,   2,
+    0,  39,   6,   1,   1,  40,  14,   1,   1,  41,  13,   1,   2,  42,  11,   1,
+    3,  43,   9,   1,   7,  44,   1,   1,  10,   0,   5,   1,   9,   1,   6,   3,
+    8,   4,   7,   3,   7,   7,   8,   4,   6,  11,   9,   1,   6,  12,   3,   2,
+    5,  14,   4,   2,   5,  16,   3,   1,   4,  17,   4,   3,   4,  20,   3,   1,
+    3,  21,   4,   2,   3,  23,   3,   1,   2,  24,   4,   3,   1,  27,   4,   3,
+    0,  30,   5,   1,  10,  12,   5,  20,   0,  31,   4,   1,   0,  32,  19,   4,
+   10,  36,   5,   8,   0,   0,  14,   5,   0,   5,   5,   9,   8,  13,   2,   1,
+    0,  14,  12,   1,   0,  15,  13,   2,   0,  17,  14,   1,   9,  18,   5,   2,
+    0,  18,   5,   3,  10,  20,   4,   1,   0,  21,   4,   1,  10,  21,   5,  16,
+   10,  37,   4,   2,   0,  31,   5,   9,   9,  39,   5,   1,   0,  40,  14,   1,
+    1,  41,  12,   1,   2,  42,  11,   1,   3,  43,   8,   1,   7,  44,   1,   1,
+    4,   0,   8,   1,   3,   1,  10,   1,   2,   2,  12,   1,   1,   3,  14,   1,
+    1,   4,   5,   2,  10,   4,   5,   2,   1,   6,   4,   1,  11,   6,   4,   2,
+   11,   8,   5,   5,   0,   7,   5,  11,   6,  17,   7,   1,   0,  18,  14,   1,
+    0,  19,  15,   2,   0,  21,   6,   1,  10,  21,   5,   1,  11,  22,   5,   4,
+   12,  26,   4,   9,   0,  22,   5,  16,  11,  35,   5,   4,   1,  38,   5,   2,
+   10,  39,   6,   1,   1,  40,  14,   1,   2,  41,  13,   1,   3,  42,  11,   1,
+    4,  43,   9,   1,   7,  44,   2,   1,   0,   0,  18,   4,  13,   4,   4,   1,
+   12,   5,   5,   2,  11,   7,   5,   3,  10,  10,   5,   3,   9,  13,   5,   4,
+    8,  17,   5,   3,   7,  20,   5,   4,   6,  24,   6,   1,   6,  25,   5,   3,
+    5,  28,   6,   1,   5,  29,   5,   4,   4,  33,   6,   2,   4,  35,   5,   5,
+    3,  40,   6,   4,   5,   0,   8,   1,   3,   1,  12,   1,   2,   2,  13,   1,
+    2,   3,  14,   1,   1,   4,   6,   1,  11,   4,   5,   2,  12,   6,   5,   9,
+   12,  15,   4,   1,   1,   5,   5,  12,  11,  16,   5,   2,   2,  17,   4,   1,
+    2,  18,   5,   1,  10,  18,   5,   1,   3,  19,  12,   1,   4,  20,  10,   1,
+    3,  21,  12,   1,   2,  22,  13,   1,   2,  23,   5,   1,  10,  23,   6,   1,
+    1,  24,   6,   1,  11,  24,   5,   2,  12,  26,   4,   1,   1,  25,   5,   3,
+    0,  28,   6,   2,   0,  30,   5,   5,   0,  35,   6,   2,  12,  27,   5,  11,
+    1,  37,   5,   2,  11,  38,   5,   2,   1,  39,   6,   1,   2,  40,  14,   1,
+    2,  41,  13,   1,   3,  42,  11,   1,   4,  43,   9,   1,   8,  44,   1,   1,
+    3,   0,   9,   1,   2,   1,  11,   1,   1,   2,  13,   2,   0,   4,   6,   1,
+    9,   4,   6,   1,   0,   5,   5,   2,  10,   5,   5,   2,  11,   7,   4,   1,
+    0,   7,   4,  14,  11,   8,   5,  14,   0,  21,   5,   2,  10,  22,   6,   1,
+    1,  23,  15,   2,   2,  25,  14,   1,   3,  26,   7,   1,   6,  27,   1,   1,
+   11,  26,   5,  10,   0,  31,   5,   7,  11,  36,   4,   2,   1,  38,   4,   1,
+   10,  38,   5,   2,   1,  39,   5,   1,   1,  40,  14,   1,   2,  41,  12,   1,
+    2,  42,  11,   1,   3,  43,   9,   1,   7,  44,   1,   1,   0,   0,   6,   7,
+    0,  20,   6,   6,  11,   0,   4,   1,   7,   1,  14,   1,   4,   2,  19,   1,
+    2,   3,  23,   1,   1,   4,   9,   1,  17,   4,  10,   1,   0,   5,   7,   1,
+   21,   5,   6,   1,   1,   6,   4,   1,  23,   6,   3,   1,   2,   7,   1,   1,
+   24,   7,   2,   1,  10,   8,   7,   1,   7,   9,  13,   1,   5,  10,  17,   1,
+    4,  11,  19,   1,   6,  12,   4,   1,  17,  12,   5,   1,   6,  13,   2,   1,
+   20,  13,   1,   1,  10,  16,   7,   1,   9,  17,   9,   1,  10,  18,   7,   1,
+   11,  19,   6,   1,  12,  20,   4,   1,  12,  21,   3,   1,  13,  22,   1,   1,
+    1,   0,   1,   1,  12,   0,   4,   1,   0,   1,   3,   1,   6,   1,  15,   1,
+    0,   2,   4,   1,   7,   2,  16,   1,   1,   3,   4,   1,   8,   3,  17,   1,
+    1,   4,   5,   1,   9,   4,   1,   1,  17,   4,  11,   1,   0,   5,   7,   1,
+   21,   5,   6,   1,   1,   6,   7,   1,  23,   6,   3,   1,   2,   7,   1,   1,
+    5,   7,   4,   1,  25,   7,   1,   1,   6,   8,   4,   1,  12,   8,   6,   1,
+    7,   9,   4,   1,  14,   9,   6,   1,   5,  10,   7,   1,  15,  10,   7,   1,
+    5,  11,   8,   1,  16,  11,   7,   1,   6,  12,   8,   1,  18,  12,   4,   1,
+    6,  13,   2,   1,  11,  13,   4,   1,  20,  13,   1,   1,  12,  14,   4,   1,
+   13,  15,   4,   1,  10,  16,   8,   1,   9,  17,  10,   1,  10,  18,  10,   1,
+   11,  19,  10,   1,  12,  20,   4,   1,  18,  20,   4,   1,  12,  21,   3,   1,
+   19,  21,   4,   1,  13,  22,   1,   1,  20,  22,   2,   1,  12,   0,   2,   1,
+   11,   1,   4,   1,  10,   2,   6,   1,   8,   3,   9,   1,   7,   4,  11,   1,
+    6,   5,  13,   1,   5,   6,  15,   1,   4,   7,   5,   1,  17,   7,   4,   1,
+    3,   8,   4,   1,  19,   8,   3,   1,   2,   9,   3,   1,   9,   9,   7,   1,
+   20,   9,   4,   1,   0,  10,   6,   1,   8,  10,  10,   1,  20,  10,   5,   1,
+    4,  11,   6,   1,  15,  11,   7,   1,   4,  12,   4,   1,  17,  12,   5,   2,
+    4,  13,   5,   1,  11,  13,   4,   1,   4,  14,  18,   1,   4,  15,   8,   1,
+   14,  15,   8,   1,   4,  16,   7,   1,  15,  16,   7,   2,   4,  17,   6,   1,
+    4,  18,   7,   1,  14,  18,   8,   1,   4,  19,  18,   2,   1,   0,   1,   1,
+    0,   1,   3,   1,   1,   2,   3,   1,  13,   2,   2,   1,   2,   3,   3,   1,
+   12,   3,   4,   1,   3,   4,   3,   1,  11,   4,   6,   1,   4,   5,   3,   1,
+   10,   5,   8,   1,   5,   6,   3,   1,  11,   6,   8,   1,   6,   7,   3,   1,
+   12,   7,   8,   1,   6,   8,   4,   1,  13,   8,   8,   1,   5,   9,   6,   1,
+   14,   9,   8,   1,   4,  10,   8,   1,  15,  10,   8,   1,   3,  11,  10,   1,
+   16,  11,   9,   1,   1,  12,  13,   1,  17,  12,   9,   1,   5,  13,  10,   1,
+   18,  13,   5,   1,   5,  14,  11,   1,  19,  14,   4,   1,   5,  15,  12,   1,
+   20,  15,   3,   1,  15,  16,   3,   1,  21,  16,   2,   1,  16,  17,   3,   1,
+   22,  17,   1,   1,  16,  18,   4,   1,  16,  19,   5,   1,  16,  20,   6,   1,
+   16,  21,   7,   1,   5,  16,   6,   7,  16,  22,   8,   1,  22,  23,   3,   1,
+   23,  24,   3,   1,  24,  25,   3,   1,  24,  26,   1,   1,   5,   0,   2,   1,
+   19,   0,   2,   1,   4,   1,   3,   1,  18,   1,   4,   1,   2,   2,   4,   1,
+   11,   2,   3,   1,  19,   2,   4,   1,   1,   3,   4,   1,   8,   3,  10,   1,
+   20,   3,   4,   1,   0,   4,   4,   1,   6,   4,  13,   1,  21,   4,   4,   1,
+    1,   5,   2,   1,   5,   5,   5,   1,  16,   5,   5,   1,  23,   5,   2,   1,
+    1,   6,   1,   1,   4,   6,   4,   1,  18,   6,   4,   1,  23,   6,   1,   1,
+    3,   7,   3,   1,  19,   7,   3,   1,   3,   8,   2,   1,  20,   8,   3,   2,
+    2,   9,   3,   1,   2,  10,   2,   1,  21,  10,   3,   3,  11,   7,   2,   7,
+   22,  13,   2,   2,  11,  14,   3,   1,  12,  15,   4,   1,   1,  11,   3,   6,
+   14,  16,   3,   1,  21,  15,   3,   3,  15,  17,   3,   1,   2,  17,   3,   2,
+   17,  18,   1,   1,  20,  18,   3,   2,   3,  19,   3,   1,   3,  20,   4,   1,
+   19,  20,   3,   1,   4,  21,   4,   1,  17,  21,   4,   1,   5,  22,   6,   1,
+   15,  22,   5,   1,   6,  23,  13,   1,   8,  24,   9,   1,   2,   0,   1,   1,
+    6,   0,   2,   1,  20,   0,   2,   1,   0,   1,   3,   1,   7,   1,   2,   1,
+   19,   1,   4,   1,   1,   2,   3,   1,  13,   2,   2,   1,  20,   2,   4,   1,
+    2,   3,   3,   1,   9,   3,  10,   1,  21,   3,   4,   1,   1,   4,   5,   1,
+   10,   4,  10,   1,  22,   4,   4,   1,   2,   5,   5,   1,  17,   5,   5,   1,
+   24,   5,   2,   1,   2,   6,   1,   1,   5,   6,   3,   1,  19,   6,   3,   1,
+   24,   6,   1,   1,   4,   7,   5,   1,  20,   7,   3,   1,   7,   8,   3,   1,
+    3,   8,   3,   2,  21,   8,   3,   2,   8,   9,   3,   1,   3,  10,   2,   1,
+    9,  10,   3,   1,  10,  11,   3,   1,  22,  10,   3,   3,  11,  12,   3,   1,
+   12,  13,   3,   1,  23,  13,   2,   2,  13,  14,   3,   1,  14,  15,   3,   1,
+    2,  11,   3,   6,  22,  15,   3,   2,  15,  16,   3,   1,  16,  17,   3,   1,
+   23,  17,   2,   1,   3,  17,   3,   2,  17,  18,   3,   1,  23,  18,   1,   1,
+    4,  19,   3,   1,  18,  19,   3,   1,   4,  20,   4,   1,  19,  20,   3,   1,
+    5,  21,   4,   1,  18,  21,   5,   1,   6,  22,   6,   1,  16,  22,   8,   1,
+    7,  23,  13,   1,  22,  23,   4,   1,   9,  24,   9,   1,  23,  24,   2,   1,
+   17,   0,   2,   1,  17,   1,   4,   1,   4,   2,   1,   1,  18,   2,   5,   1,
+    3,   3,   3,   1,  12,   3,   3,   1,  20,   3,   5,   1,   2,   4,   4,   1,
+    9,   4,  10,   1,  21,   4,   3,   1,   1,   5,   4,   1,   7,   5,  13,   1,
+   23,   5,   1,   1,   0,   6,   4,   1,   6,   6,   4,   1,  17,   6,   5,   1,
+    1,   7,   2,   1,   5,   7,   4,   1,  19,   7,   3,   1,   2,   8,   1,   1,
+    4,   8,   3,   1,  13,   8,   1,   1,  20,   8,   3,   1,  11,   9,   2,   1,
+    3,   9,   3,   2,  21,   9,   3,   2,   3,  11,   2,   1,  22,  11,   3,   3,
+   12,  10,   2,   5,  23,  14,   2,   1,  12,  15,   4,   1,  13,  16,   5,   1,
+    2,  12,   3,   6,  16,  17,   4,   1,  22,  15,   3,   4,  18,  18,   1,   1,
+    3,  18,   3,   2,  21,  19,   3,   2,   4,  20,   3,   1,   4,  21,   4,   1,
+   20,  21,   3,   1,   5,  22,   4,   1,  18,  22,   4,   1,   6,  23,   6,   1,
+   16,  23,   5,   1,   7,  24,  13,   1,   9,  25,   9,   1,   6,   0,   2,   1,
+    4,   1,   5,   1,   2,   2,   6,   1,  20,   2,   1,   1,   1,   3,   5,   1,
+   10,   3,   3,   1,  19,   3,   3,   1,   1,   4,   3,   1,   7,   4,  10,   1,
+   20,   4,   3,   1,   2,   5,   1,   1,   5,   5,  13,   1,  20,   5,   4,   1,
+    4,   6,   4,   1,  15,   6,   5,   1,  21,   6,   4,   1,   3,   7,   4,   1,
+   17,   7,   3,   1,  22,   7,   3,   1,   2,   8,   3,   1,  11,   8,   1,   1,
+   18,   8,   3,   1,  23,   8,   1,   1,   1,   9,   3,   2,  19,   9,   3,   2,
+    1,  11,   2,   1,  11,   9,   2,   5,  20,  11,   3,   3,  10,  14,   2,   1,
+   21,  14,   2,   2,  10,  15,   3,   1,   0,  12,   3,   5,  11,  16,   3,   1,
+    1,  17,   2,   1,  12,  17,   3,   1,  20,  16,   3,   3,  13,  18,   3,   1,
+    1,  18,   3,   2,  14,  19,   3,   1,  19,  19,   3,   2,   2,  20,   3,   1,
+   15,  20,   1,   1,   2,  21,   4,   1,  18,  21,   3,   1,   3,  22,   4,   1,
+   16,  22,   4,   1,   4,  23,   6,   1,  14,  23,   5,   1,   5,  24,  13,   1,
+    7,  25,   9,   1,   5,   0,   2,   1,  19,   0,   2,   1,   4,   1,   3,   1,
+   18,   1,   4,   1,   2,   2,   4,   1,  11,   2,   3,   1,  19,   2,   4,   1,
+    1,   3,   4,   1,   8,   3,  10,   1,  20,   3,   4,   1,   0,   4,   4,   1,
+    6,   4,  13,   1,  21,   4,   4,   1,   1,   5,   2,   1,   5,   5,   5,   1,
+   16,   5,   5,   1,  23,   5,   2,   1,   1,   6,   1,   1,   4,   6,   4,   1,
+   18,   6,   3,   1,  23,   6,   1,   1,   3,   7,   3,   1,  19,   7,   3,   1,
+    2,   8,   3,   2,  20,   8,   3,   2,   9,   9,   8,   2,   2,  10,   2,   1,
+   13,  11,   3,   1,  21,  10,   3,   3,  12,  12,   3,   1,  12,  13,   2,   1,
+   22,  13,   2,   2,  11,  14,   3,   1,  10,  15,   3,   1,   1,  11,   3,   6,
+   21,  15,   3,   3,   9,  16,   8,   3,   2,  17,   3,   2,  20,  18,   3,   2,
+    3,  19,   3,   1,   3,  20,   4,   1,  19,  20,   3,   1,   4,  21,   4,   1,
+   17,  21,   4,   1,   5,  22,   6,   1,  15,  22,   5,   1,   6,  23,  13,   1,
+    8,  24,   9,   1,  17,   0,   6,   1,  15,   1,  10,   1,  14,   2,   6,   1,
+   21,   2,   6,   1,  13,   3,   4,   1,  24,   3,   3,   1,  12,   4,   4,   1,
+   25,   4,   3,   1,  12,   5,   3,   1,  12,   6,   2,   1,  26,   5,   3,   3,
+   19,   5,   2,   4,  27,   8,   2,   2,  19,   9,   3,   1,  11,   7,   3,   4,
+   20,  10,   4,   1,  26,  10,   3,   2,  12,  11,   2,   1,  22,  11,   1,   1,
+   12,  12,   3,   1,  25,  12,   3,   2,   5,  13,   5,   1,  13,  13,   3,   1,
+   13,  14,   4,   1,  23,  14,   4,   1,  13,  15,  14,   1,   4,  14,   7,   5,
+    5,  19,   5,   1,   0,  10,   2,  12,  13,  16,  15,   6,   0,  22,  28,   3,
+    0,  25,   2,   4,  25,  25,   3,   4,   1,   0,   2,   1,  14,   0,   2,   1,
+    0,   1,   4,   1,  11,   1,   1,   1,  14,   1,   4,   1,   1,   2,   4,   1,
+   10,   2,   2,   1,  14,   2,   5,   1,   2,   3,   4,   1,   9,   3,   3,   1,
+   16,   3,   4,   1,   3,   4,   4,   1,  10,   4,   2,   1,  17,   4,   4,   1,
+    4,   5,   4,   1,  11,   5,   1,   1,  18,   5,   4,   1,   5,   6,   4,   1,
+   14,   6,   1,   1,  19,   6,   3,   1,   0,   7,  10,   1,  14,   7,   2,   1,
+   20,   7,   2,   1,   0,   8,  11,   1,  14,   8,   3,   1,  20,   8,   3,   2,
+    0,   9,  12,   1,  15,   9,   2,   1,   0,  10,  13,   1,  16,  10,   1,   1,
+   21,  10,   2,   2,   0,  11,  14,   1,  17,  11,   1,   1,   0,  12,  15,   1,
+    0,  13,  16,   1,  20,  12,   3,   3,   0,  14,  12,   1,  13,  14,   4,   1,
+    6,  15,   6,   1,  14,  15,   4,   1,  21,  15,   1,   2,   7,  16,   5,   1,
+   15,  16,   4,   1,   8,  17,   4,   1,  16,  17,   4,   1,   9,  18,   3,   1,
+   17,  18,   4,   1,  10,  19,   2,   1,  15,  19,   7,   1,  11,  20,   1,   1,
+   14,  20,   4,   1,  19,  20,   4,   1,  14,  21,   3,   1,  20,  21,   3,   1,
+   21,  22,   1,   1,  11,   0,   4,   1,   7,   1,  14,   1,   4,   2,  19,   1,
+    2,   3,  23,   1,   1,   4,   9,   1,  17,   4,  10,   1,   0,   5,   7,   1,
+   21,   5,   6,   1,   1,   6,   4,   1,  23,   6,   3,   1,   2,   7,   1,   1,
+   24,   7,   2,   1,  10,   8,   7,   1,   7,   9,  13,   1,   5,  10,  17,   1,
+    4,  11,  19,   1,   6,  12,   4,   1,  17,  12,   2,   1,   6,  13,   2,   1,
+   21,  15,   3,   1,  10,  16,   5,   1,  21,  16,   4,   1,   9,  17,   5,   1,
+   17,  17,  11,   1,  10,  18,   4,   1,  17,  18,  12,   1,  11,  19,   3,   1,
+   17,  19,   4,   1,  24,  19,   4,   1,  12,  20,   2,   2,  18,  20,   3,   2,
+   24,  20,   3,   2,  13,  22,   1,   1,  17,  22,   5,   1,  23,  22,   6,   1,
+   17,  23,  11,   1,  18,  24,  10,   1,  21,  25,   3,   2 };
+
+constexpr RLEglyph Antonio_Regular26ptRLEGlyphs[] PROGMEM = {
+  {     0,    0,    1,    1,   21,    0,    0 },    // 0x20 ' '
+  {     0,    0,    0,    0,    0,    0,    0 },    // 0x21 '!'
+  {     0,    0,    0,    0,    0,    0,    0 },    // 0x22 '"'
+  {     0,    0,    0,    0,    0,    0,    0 },    // 0x23 '#'
+  {     0,    0,    0,    0,    0,    0,    0 },    // 0x24 '$'
+  {     0,    0,    0,    0,    0,    0,    0 },    // 0x25 '%'
+  {     0,    0,    0,    0,    0,    0,    0 },    // 0x26 '&'
+  {     0,    0,    0,    0,    0,    0,    0 },    // 0x27 '''
+  {     0,    0,    0,    0,    0,    0,    0 },    // 0x28 '('
+  {     0,    0,    0,    0,    0,    0,    0 },    // 0x29 ')'
+  {     0,    0,    0,    0,    0,    0,    0 },    // 0x2A '*'
+  {     0,    0,    0,    0,    0,    0,    0 },    // 0x2B '+'
+  {     0,    0,    0,    0,    0,    0,    0 },    // 0x2C ','
+  {     0,    0,    0,    0,    0,    0,    0 },    // 0x2D '-'
+  {     0,    0,    0,    0,    0,    0,    0 },    // 0x2E '.'
+  {     0,    0,    0,    0,    0,    0,    0 },    // 0x2F '/'
+  {     0,   13,   15,   45,   21,    3,  -43 },    // 0x30 '0'
+  {    13,   10,   12,   44,   21,    3,  -43 },    // 0x31 '1'
+  {    23,   32,   16,   44,   21,    4,  -43 },    // 0x32 '2'
+  {    55,   27,   16,   45,   21,    3,  -43 },    // 0x33 '3'
+  {    82,   19,   19,   44,   21,    2,  -43 },    // 0x34 '4'
+  {   101,   19,   15,   45,   21,    4,  -43 },    // 0x35 '5'
+  {   120,   26,   16,   45,   21,    3,  -43 },    // 0x36 '6'
+  {   146,   15,   18,   44,   21,    2,  -43 },    // 0x37 '7'
+  {   161,   35,   17,   45,   21,    2,  -43 },    // 0x38 '8'
+  {   196,   27,   16,   45,   21,    3,  -43 },    // 0x39 '9'
+  {   223,    2,    6,   26,   12,    3,  -32 },    // 0x3A ':'
+  {   225,   27,   27,   23,   21,   -3,  -30 },    // 0x3B ';'
+  {   252,   43,   28,   23,   21,   -3,  -30 },    // 0x3C '<'
+  {   295,   32,   25,   21,   21,   -2,  -29 },    // 0x3D '='
+  {   327,   44,   27,   27,   21,   -3,  -31 },    // 0x3E '>'
+  {   371,   48,   25,   25,   21,   -2,  -32 },    // 0x3F '?'
+  {   419,   57,   26,   25,   21,   -3,  -32 },    // 0x40 '@'
+  {   476,   47,   25,   27,   21,   -3,  -33 },    // 0x41 'A'
+  {   523,   50,   25,   27,   21,   -1,  -33 },    // 0x42 'B'
+  {   573,   48,   25,   25,   21,   -2,  -32 },    // 0x43 'C'
+  {   621,   33,   29,   29,   21,   -4,  -34 },    // 0x44 'D'
+  {   654,   55,   23,   23,   21,   -1,  -30 },    // 0x45 'E'
+  {   709,   38,   29,   27,   21,   -3,  -30 } };   // 0x46 'F'
+
+constexpr RLEfont Antonio_Regular26ptRLE PROGMEM = {
+  Antonio_Regular26ptRLESpans,
+  Antonio_Regular26ptRLEGlyphs,
+  0x20, 0x46, 66, 43, 45 };
+
+// Approx. 3378 bytes (747 spans)
@@ -1,686 +0,0 @@
-const uint8_t Antonio_SemiBold75pt7bBitmaps[] PROGMEM = {
-  0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x00,
-  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xE0,
-  0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFE,
-  0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x03, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xE0, 0x0F,
-  0xFF, 0xFE, 0x3F, 0xFF, 0xE0, 0x03, 0xFF, 0xFF, 0x1F, 0xFF, 0xF0, 0x00,
-  0xFF, 0xFF, 0x9F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xCF, 0xFF, 0xF8, 0x00,
-  0x1F, 0xFF, 0xE7, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFC, 0x00,
-  0x07, 0xFF, 0xFD, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0xFF, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0xC0,
-  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0,
-  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC,
-  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE,
-  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-  0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-  0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-  0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF,
-  0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-  0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF,
-  0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF,
-  0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF,
-  0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF,
-  0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF,
-  0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF,
-  0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF,
-  0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F,
-  0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F,
-  0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07,
-  0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01,
-  0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-  0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-  0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-  0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-  0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0,
-  0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC,
-  0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-  0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-  0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-  0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF,
-  0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xFF,
-  0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF,
-  0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF,
-  0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-  0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x03, 0xFF,
-  0xFD, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-  0xFF, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0xC0, 0x00, 0x3F,
-  0xFF, 0xDF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xEF, 0xFF, 0xF0, 0x00, 0x1F,
-  0xFF, 0xF7, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xFB, 0xFF, 0xFE, 0x00, 0x07,
-  0xFF, 0xF8, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x7F, 0xFF, 0x80, 0x03,
-  0xFF, 0xFE, 0x3F, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0x1F, 0xFF, 0xF0, 0x01,
-  0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x01, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xF0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x3F, 0xFF,
-  0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-  0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x0F,
-  0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-  0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x00,
-  0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xF0, 0x00,
-  0x00, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF8,
-  0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
-  0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xF0, 0x07, 0xFF,
-  0xFF, 0xFE, 0x03, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xF1,
-  0xFF, 0xFF, 0xFF, 0xFC, 0x3F, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF, 0xFE,
-  0x00, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFE,
-  0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x01, 0xFF,
-  0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00,
-  0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFE, 0x00,
-  0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF,
-  0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-  0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00,
-  0x7F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x00,
-  0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
-  0x80, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x7F,
-  0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00,
-  0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x80,
-  0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF,
-  0xC0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x3F,
-  0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00,
-  0x1F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xC0,
-  0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF,
-  0xE0, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x1F,
-  0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00,
-  0x0F, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE0,
-  0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF,
-  0xF0, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0F,
-  0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00,
-  0x07, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF0,
-  0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-  0xF8, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x07,
-  0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF0, 0x00,
-  0x03, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF8,
-  0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xFF,
-  0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x03,
-  0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-  0x01, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFC,
-  0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-  0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x01,
-  0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-  0x00, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFE,
-  0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-  0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-  0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x01,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F,
-  0xFF, 0xF0, 0x0F, 0xFF, 0xF8, 0x3F, 0xFF, 0xE0, 0x07, 0xFF, 0xF8, 0x3F,
-  0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x3F,
-  0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x3F, 0xFF, 0x80, 0x01, 0xFF, 0xFC, 0x7F,
-  0xFF, 0x80, 0x01, 0xFF, 0xFC, 0x7F, 0xFF, 0x80, 0x01, 0xFF, 0xFE, 0x7F,
-  0xFF, 0x80, 0x01, 0xFF, 0xFE, 0x7F, 0xFF, 0x80, 0x01, 0xFF, 0xFE, 0x7F,
-  0xFF, 0x80, 0x01, 0xFF, 0xFE, 0x7F, 0xFF, 0x00, 0x01, 0xFF, 0xFE, 0x7F,
-  0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF,
-  0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF,
-  0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF,
-  0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF,
-  0xFF, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF,
-  0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF,
-  0xFF, 0x00, 0x00, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFE, 0xFF,
-  0xFF, 0x00, 0x01, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFE, 0xFF,
-  0xFF, 0x00, 0x01, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFE, 0xFF,
-  0xFF, 0x00, 0x01, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFE, 0xFF,
-  0xFF, 0x00, 0x01, 0xFF, 0xFC, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0xFF,
-  0xFF, 0x00, 0x03, 0xFF, 0xFC, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0xFF,
-  0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00,
-  0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00,
-  0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-  0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00,
-  0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-  0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00,
-  0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00,
-  0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00,
-  0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00,
-  0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00,
-  0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00,
-  0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-  0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-  0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-  0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-  0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
-  0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-  0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00,
-  0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-  0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x01,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03,
-  0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x07,
-  0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07,
-  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F,
-  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F,
-  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-  0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F,
-  0xFF, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F,
-  0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x7F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x00, 0x00,
-  0x00, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-  0x00, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
-  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC,
-  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF, 0xF8, 0x3F, 0xFF, 0xE0,
-  0x03, 0xFF, 0xFF, 0x1F, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xC7, 0xFF, 0xFC,
-  0x00, 0x0F, 0xFF, 0xF1, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFE, 0x7F, 0xFF,
-  0x80, 0x00, 0xFF, 0xFF, 0x9F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xE7, 0xFF,
-  0xF8, 0x00, 0x07, 0xFF, 0xFB, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0xFF,
-  0xFF, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xFF,
-  0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-  0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F,
-  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-  0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-  0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00,
-  0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00,
-  0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00,
-  0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00,
-  0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00,
-  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0,
-  0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC,
-  0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF,
-  0x80, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x7F, 0xFF, 0xFF,
-  0xF0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-  0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-  0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x07, 0xFF,
-  0xFF, 0xF0, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F,
-  0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x07,
-  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00,
-  0x00, 0x3F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00,
-  0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0,
-  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-  0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF,
-  0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F,
-  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-  0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80,
-  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8,
-  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-  0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-  0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-  0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF,
-  0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF,
-  0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF,
-  0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x7F,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xEF, 0xFF, 0xF0, 0x00, 0x07,
-  0xFF, 0xF9, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x7F, 0xFF, 0x00, 0x00,
-  0xFF, 0xFF, 0x9F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xE7, 0xFF, 0xF8, 0x00,
-  0x0F, 0xFF, 0xF1, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0,
-  0x01, 0xFF, 0xFF, 0x0F, 0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0x83, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-  0x3F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x80,
-  0x00, 0x01, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x80,
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-  0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-  0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
-  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-  0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-  0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00,
-  0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFC,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF,
-  0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-  0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00,
-  0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-  0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03,
-  0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-  0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC,
-  0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-  0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-  0x0F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00,
-  0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFB, 0xFF,
-  0xFC, 0x00, 0x00, 0x00, 0x1F, 0xFB, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F,
-  0xFB, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x3F, 0xFB, 0xFF, 0xFC, 0x00, 0x00,
-  0x00, 0x3F, 0xF3, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xF3, 0xFF, 0xFC,
-  0x00, 0x00, 0x00, 0x7F, 0xF3, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x7F, 0xE3,
-  0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE3, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-  0xFF, 0xE3, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xFF, 0xE3, 0xFF, 0xFC, 0x00,
-  0x00, 0x01, 0xFF, 0xC3, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC3, 0xFF,
-  0xFC, 0x00, 0x00, 0x01, 0xFF, 0xC3, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF,
-  0xC3, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x83, 0xFF, 0xFC, 0x00, 0x00,
-  0x03, 0xFF, 0x83, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0x83, 0xFF, 0xFC,
-  0x00, 0x00, 0x07, 0xFF, 0x83, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x03,
-  0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F,
-  0xFF, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x03, 0xFF, 0xFC, 0x00,
-  0x00, 0x0F, 0xFE, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFE, 0x03, 0xFF,
-  0xFC, 0x00, 0x00, 0x1F, 0xFE, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFC,
-  0x03, 0xFF, 0xFC, 0x00, 0x00, 0x1F, 0xFC, 0x03, 0xFF, 0xFC, 0x00, 0x00,
-  0x3F, 0xFC, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x3F, 0xFC, 0x03, 0xFF, 0xFC,
-  0x00, 0x00, 0x3F, 0xF8, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x03,
-  0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x7F,
-  0xF8, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00,
-  0x00, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xF0, 0x03, 0xFF,
-  0xFC, 0x00, 0x00, 0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xE0,
-  0x03, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x01,
-  0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xFC,
-  0x00, 0x03, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xC0, 0x03,
-  0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xC0, 0x03, 0xFF, 0xFC, 0x00, 0x07, 0xFF,
-  0x80, 0x03, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0x80, 0x03, 0xFF, 0xFC, 0x00,
-  0x0F, 0xFF, 0x80, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0x80, 0x03, 0xFF,
-  0xFC, 0x00, 0x0F, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0x00,
-  0x03, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x1F,
-  0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x1F, 0xFE, 0x00, 0x03, 0xFF, 0xFC,
-  0x00, 0x3F, 0xFE, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x3F, 0xFE, 0x00, 0x03,
-  0xFF, 0xFC, 0x00, 0x3F, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xFC,
-  0x00, 0x03, 0xFF, 0xFC, 0x00, 0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-  0x7F, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-  0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00,
-  0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03,
-  0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-  0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-  0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
-  0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00,
-  0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC,
-  0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03,
-  0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00,
-  0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-  0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF,
-  0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-  0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x87, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFE, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-  0x00, 0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0,
-  0x00, 0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00,
-  0x00, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00,
-  0x00, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00,
-  0x00, 0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00,
-  0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00,
-  0x01, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-  0x1F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x01,
-  0xFF, 0xFC, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F,
-  0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF,
-  0xFC, 0x03, 0xFC, 0x00, 0x07, 0xFF, 0xF0, 0x7F, 0xFE, 0x00, 0x1F, 0xFF,
-  0xC7, 0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0x3F, 0xFF, 0xFC, 0x01, 0xFF, 0xFD,
-  0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x1F, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0xFF, 0xFE, 0x1F, 0xFF,
-  0xFC, 0x7F, 0xFF, 0xE0, 0x1F, 0xFF, 0xF1, 0xFF, 0xFF, 0x00, 0x3F, 0xFF,
-  0xE7, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x9F, 0xFF, 0xE0, 0x01, 0xFF, 0xFE,
-  0x7F, 0xFF, 0x00, 0x07, 0xFF, 0xF9, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xE7,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x9F, 0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x7F,
-  0xFE, 0x00, 0x03, 0xFF, 0xFD, 0xFF, 0xF8, 0x00, 0x0F, 0xFF, 0xF7, 0xFF,
-  0xE0, 0x00, 0x3F, 0xFF, 0xC0, 0x1F, 0x80, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-  0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
-  0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-  0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-  0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03,
-  0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F,
-  0xFF, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF,
-  0xFC, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF,
-  0xC0, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC,
-  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0,
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-  0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC,
-  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
-  0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F,
-  0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF,
-  0xFF, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xEF,
-  0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0xBF, 0xFF, 0xC0, 0x00, 0xFF, 0xFE, 0xFF,
-  0xFF, 0x00, 0x07, 0xFF, 0xFB, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xEF, 0xFF,
-  0xF8, 0x00, 0x7F, 0xFF, 0x9F, 0xFF, 0xF0, 0x03, 0xFF, 0xFC, 0x7F, 0xFF,
-  0xE0, 0x3F, 0xFF, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFE, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x3F, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xE0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-  0xE0, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF0,
-  0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00,
-  0x00, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFC,
-  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x07, 0xFF, 0xFF,
-  0xFF, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F,
-  0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x03,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x80, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xF0, 0x1F, 0xFF, 0xE0, 0x01, 0xFF,
-  0xFE, 0x07, 0xFF, 0xFC, 0x00, 0x3F, 0xFF, 0xC0, 0xFF, 0xFF, 0x00, 0x03,
-  0xFF, 0xF8, 0x1F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0x83, 0xFF, 0xFC, 0x00,
-  0x0F, 0xFF, 0xF0, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x1F, 0xFF, 0xE0,
-  0x00, 0x1F, 0xFF, 0xC3, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xF8, 0x7F, 0xFF,
-  0x80, 0x00, 0x7F, 0xFF, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF, 0xE1, 0xFF,
-  0xFE, 0x00, 0x01, 0xFF, 0xFC, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x87,
-  0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xF0, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-  0x3F, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xE7, 0xFF, 0xFC, 0x00, 0x03, 0xFF,
-  0xFC, 0xFF, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x9F, 0xFF, 0xE0, 0x00, 0x0F,
-  0xFF, 0xF3, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x7F, 0xFF, 0x80, 0x00,
-  0x3F, 0xFF, 0xCF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF9, 0xFF, 0xFE, 0x00,
-  0x00, 0xFF, 0xFF, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xE7, 0xFF, 0xF8,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF,
-  0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x7F,
-  0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01,
-  0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-  0x07, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x1F, 0xFF, 0xE0, 0x0F, 0xF8, 0x00, 0x03, 0xFF, 0xFC, 0x0F, 0xFF,
-  0xF0, 0x00, 0x7F, 0xFF, 0x87, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF3, 0xFF,
-  0xFF, 0xFC, 0x01, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFC, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xF8, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x83, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-  0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xE0, 0x1F, 0xFF,
-  0xF8, 0xFF, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0x9F, 0xFF, 0xF8, 0x00, 0x1F,
-  0xFF, 0xF3, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x7F, 0xFF, 0xC0, 0x00,
-  0x3F, 0xFF, 0xCF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xF9, 0xFF, 0xFE, 0x00,
-  0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF7, 0xFF, 0xF8,
-  0x00, 0x01, 0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xDF, 0xFF,
-  0xE0, 0x00, 0x03, 0xFF, 0xFB, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0x7F,
-  0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xEF, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFD,
-  0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xBF, 0xFF, 0xC0, 0x00, 0x07, 0xFF,
-  0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F,
-  0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
-  0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-  0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03, 0xFF, 0xFF, 0xFF,
-  0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x0F, 0xFF, 0xFF,
-  0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x3F, 0xFF,
-  0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x03,
-  0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
-  0x0F, 0xFF, 0xF7, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xFE, 0xFF, 0xFF, 0x00,
-  0x00, 0x3F, 0xFF, 0x9F, 0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xF3, 0xFF, 0xFC,
-  0x00, 0x00, 0xFF, 0xFE, 0x7F, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xCF, 0xFF,
-  0xF0, 0x00, 0x03, 0xFF, 0xF9, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0x3F,
-  0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xE7, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFC,
-  0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x0F, 0xFF, 0xF0, 0x00, 0x0F, 0xFF,
-  0xE1, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0x00, 0x7F,
-  0xFF, 0x83, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xF0, 0x7F, 0xFF, 0xF8, 0x0F,
-  0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x03, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x07,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-  0x07, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0x00,
-  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xE0,
-  0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00,
-  0x00, 0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00,
-  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC,
-  0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF,
-  0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F,
-  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-  0x00, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00,
-  0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00,
-  0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8,
-  0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-  0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
-  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-  0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00,
-  0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-  0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-  0xF0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x0F,
-  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-  0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00,
-  0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00,
-  0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF8,
-  0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-  0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F,
-  0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-  0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00, 0x00,
-  0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE, 0x00,
-  0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC,
-  0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x07, 0xFF,
-  0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x0F,
-  0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
-  0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00,
-  0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFE,
-  0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03, 0xFF,
-  0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07,
-  0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
-  0x07, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
-  0x00, 0x0F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
-  0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x80,
-  0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF,
-  0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0xFF,
-  0xFF, 0x80, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01,
-  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-  0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00, 0x00,
-  0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0, 0x00,
-  0x00, 0x00, 0x03, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xE0,
-  0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-  0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x7F,
-  0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
-  0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00,
-  0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x00,
-  0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFC,
-  0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF,
-  0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F,
-  0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x00, 0x00, 0x00,
-  0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xF0, 0x00,
-  0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC,
-  0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-  0xFC, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFE, 0x07, 0xFF,
-  0xFE, 0x00, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xF8, 0x3F,
-  0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x87, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xF0,
-  0xFF, 0xFF, 0x00, 0x01, 0xFF, 0xFE, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF,
-  0xC7, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-  0xFF, 0x9F, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF3, 0xFF, 0xFC, 0x00, 0x01,
-  0xFF, 0xFE, 0x7F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xCF, 0xFF, 0xF0, 0x00,
-  0x07, 0xFF, 0xF9, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x7F, 0xFF, 0xC0,
-  0x00, 0x1F, 0xFF, 0xEF, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFD, 0xFF, 0xFF,
-  0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF7, 0xFF,
-  0xFC, 0x00, 0x01, 0xFF, 0xFE, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xDF,
-  0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFB, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-  0x7F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xE7, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
-  0xFC, 0xFF, 0xFF, 0x00, 0x00, 0x7F, 0xFF, 0x9F, 0xFF, 0xE0, 0x00, 0x0F,
-  0xFF, 0xF3, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0x7F, 0xFF, 0x80, 0x00,
-  0x3F, 0xFF, 0xCF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF9, 0xFF, 0xFE, 0x00,
-  0x00, 0xFF, 0xFF, 0x3F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xC3, 0xFF, 0xF8,
-  0x00, 0x07, 0xFF, 0xF8, 0x7F, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x0F, 0xFF,
-  0xF0, 0x00, 0x1F, 0xFF, 0xE1, 0xFF, 0xFE, 0x00, 0x03, 0xFF, 0xFC, 0x1F,
-  0xFF, 0xC0, 0x00, 0xFF, 0xFF, 0x03, 0xFF, 0xFC, 0x00, 0x1F, 0xFF, 0xE0,
-  0x7F, 0xFF, 0x80, 0x03, 0xFF, 0xFC, 0x07, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
-  0x00, 0xFF, 0xFF, 0x00, 0x3F, 0xFF, 0xE0, 0x0F, 0xFF, 0xF0, 0x0F, 0xFF,
-  0xF8, 0x01, 0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xFF,
-  0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x1F, 0xFF,
-  0xFF, 0xFF, 0xC0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x01, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x0F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x1F, 0xFF, 0xFC, 0x7F, 0xFF, 0xF0,
-  0x07, 0xFF, 0xFE, 0x03, 0xFF, 0xFE, 0x00, 0xFF, 0xFF, 0x80, 0x3F, 0xFF,
-  0xE0, 0x3F, 0xFF, 0xE0, 0x03, 0xFF, 0xFC, 0x07, 0xFF, 0xFC, 0x00, 0x7F,
-  0xFF, 0x80, 0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xF8, 0x3F, 0xFF, 0xE0, 0x00,
-  0xFF, 0xFF, 0x07, 0xFF, 0xF8, 0x00, 0x1F, 0xFF, 0xE0, 0xFF, 0xFF, 0x00,
-  0x01, 0xFF, 0xFE, 0x3F, 0xFF, 0xE0, 0x00, 0x3F, 0xFF, 0xC7, 0xFF, 0xF8,
-  0x00, 0x07, 0xFF, 0xF8, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x1F, 0xFF,
-  0xE0, 0x00, 0x1F, 0xFF, 0xF3, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFE, 0xFF,
-  0xFF, 0x80, 0x00, 0x7F, 0xFF, 0xDF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFB,
-  0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x7F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF,
-  0xEF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFD, 0xFF, 0xFE, 0x00, 0x00, 0x7F,
-  0xFF, 0xBF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xF7, 0xFF, 0xF8, 0x00, 0x01,
-  0xFF, 0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
-  0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x80,
-  0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFE,
-  0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-  0xF8, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF,
-  0xFF, 0xE0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x03, 0xFF,
-  0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xBF, 0xFF, 0xC0, 0x00, 0x0F,
-  0xFF, 0xF7, 0xFF, 0xFC, 0x00, 0x01, 0xFF, 0xFE, 0xFF, 0xFF, 0x80, 0x00,
-  0x3F, 0xFF, 0xDF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFB, 0xFF, 0xFE, 0x00,
-  0x00, 0xFF, 0xFF, 0x7F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xE7, 0xFF, 0xF8,
-  0x00, 0x07, 0xFF, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF, 0x9F, 0xFF,
-  0xF0, 0x00, 0x1F, 0xFF, 0xE3, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFC, 0x3F,
-  0xFF, 0xE0, 0x00, 0xFF, 0xFF, 0x87, 0xFF, 0xFE, 0x00, 0x3F, 0xFF, 0xF0,
-  0xFF, 0xFF, 0xE0, 0x0F, 0xFF, 0xFC, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x3F, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xE0, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x7F, 0xFF,
-  0xFF, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x7F,
-  0xFF, 0xFF, 0xFE, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
-  0x1F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x00,
-  0x00, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF8, 0x00,
-  0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8,
-  0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-  0xF0, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xC0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x01, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFE, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xF0, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x07, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x7F, 0xFF,
-  0xE0, 0x1F, 0xFF, 0xFC, 0x3F, 0xFF, 0xF0, 0x03, 0xFF, 0xFF, 0x0F, 0xFF,
-  0xF8, 0x00, 0x7F, 0xFF, 0xC3, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xF8, 0xFF,
-  0xFF, 0x00, 0x03, 0xFF, 0xFE, 0x7F, 0xFF, 0x80, 0x00, 0x7F, 0xFF, 0x9F,
-  0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xE7, 0xFF, 0xF8, 0x00, 0x07, 0xFF, 0xF9,
-  0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFE, 0x7F, 0xFF, 0x00, 0x00, 0x7F, 0xFF,
-  0x9F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0xF7, 0xFF, 0xF0, 0x00, 0x03, 0xFF,
-  0xFD, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0x7F, 0xFF, 0x00, 0x00, 0x3F,
-  0xFF, 0xDF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x03,
-  0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-  0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
-  0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0,
-  0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-  0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
-  0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-  0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF, 0xFF,
-  0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xFF,
-  0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x0F, 0xFF,
-  0xFF, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFD, 0xFF, 0xFC, 0x00, 0x00, 0xFF,
-  0xFF, 0x7F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xDF, 0xFF, 0xC0, 0x00, 0x0F,
-  0xFF, 0xF7, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xFD, 0xFF, 0xFC, 0x00, 0x00,
-  0xFF, 0xFF, 0x7F, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xDF, 0xFF, 0xE0, 0x00,
-  0x0F, 0xFF, 0xF7, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFD, 0xFF, 0xFE, 0x00,
-  0x00, 0xFF, 0xFF, 0x3F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xCF, 0xFF, 0xE0,
-  0x00, 0x0F, 0xFF, 0xF3, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0xFF, 0xFF,
-  0x00, 0x00, 0xFF, 0xFF, 0x3F, 0xFF, 0xE0, 0x00, 0x7F, 0xFF, 0xC7, 0xFF,
-  0xFC, 0x00, 0x7F, 0xFF, 0xF1, 0xFF, 0xFF, 0xC0, 0x7F, 0xFF, 0xFC, 0x7F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC3,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC,
-  0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFC, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xC0, 0x0F, 0xFF, 0xFF, 0xEF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xE3,
-  0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xE0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-  0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00,
-  0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-  0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00,
-  0x00, 0x03, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00,
-  0x00, 0x00, 0x3F, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00,
-  0x00, 0x00, 0x03, 0xFF, 0xFC, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF, 0x3F,
-  0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xCF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF, 0xF3,
-  0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFC, 0xFF, 0xFE, 0x00, 0x00, 0xFF, 0xFF,
-  0x3F, 0xFF, 0x80, 0x00, 0x3F, 0xFF, 0xCF, 0xFF, 0xE0, 0x00, 0x0F, 0xFF,
-  0xF3, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0xFF, 0xFF, 0x00, 0x00, 0xFF,
-  0xFF, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0xCF, 0xFF, 0xF0, 0x00, 0x0F,
-  0xFF, 0xF3, 0xFF, 0xFC, 0x00, 0x03, 0xFF, 0xFC, 0xFF, 0xFF, 0x00, 0x00,
-  0xFF, 0xFE, 0x3F, 0xFF, 0xC0, 0x00, 0x3F, 0xFF, 0x87, 0xFF, 0xF0, 0x00,
-  0x0F, 0xFF, 0xE1, 0xFF, 0xFC, 0x00, 0x07, 0xFF, 0xF8, 0x7F, 0xFF, 0x00,
-  0x01, 0xFF, 0xFE, 0x1F, 0xFF, 0xC0, 0x00, 0x7F, 0xFF, 0x87, 0xFF, 0xF0,
-  0x00, 0x1F, 0xFF, 0xE1, 0xFF, 0xFE, 0x00, 0x07, 0xFF, 0xF0, 0x7F, 0xFF,
-  0x80, 0x03, 0xFF, 0xFC, 0x0F, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x03, 0xFF,
-  0xFE, 0x00, 0x7F, 0xFF, 0xC0, 0xFF, 0xFF, 0xC0, 0x3F, 0xFF, 0xE0, 0x3F,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x01,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0,
-  0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
-  0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFE,
-  0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF,
-  0x80, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-  0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x7F, 0xFF,
-  0x80, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0 };
-
-const GFXglyph Antonio_SemiBold75pt7bGlyphs[] PROGMEM = {
-  {     0,  49, 130,  66,    8, -127 },   // 0x30 '0'
-  {   797,  35, 126,  66,   11, -125 },   // 0x31 '1'
-  {  1349,  48, 128,  66,   10, -127 },   // 0x32 '2'
-  {  2117,  50, 129,  66,    8, -127 },   // 0x33 '3'
-  {  2924,  56, 126,  66,    6, -125 },   // 0x34 '4'
-  {  3806,  46, 127,  66,   10, -125 },   // 0x35 '5'
-  {  4537,  51, 130,  66,    8, -127 },   // 0x36 '6'
-  {  5366,  52, 126,  66,    7, -125 },   // 0x37 '7'
-  {  6185,  51, 129,  66,    7, -127 },   // 0x38 '8'
-  {  7008,  50, 129,  66,    6, -127 },   // 0x39 '9'
-  {  7815,  17,  75,  37,   10,  -93 } }; // 0x3A ':'
-
-const GFXfont Antonio_SemiBold75pt7b PROGMEM = {
-  (uint8_t  *)Antonio_SemiBold75pt7bBitmaps,
-  (GFXglyph *)Antonio_SemiBold75pt7bGlyphs,
-  0x30, 0x3A, 190 };
-
-// Approx. 8059 bytes
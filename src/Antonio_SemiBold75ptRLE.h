@@ -0,0 +1,180 @@
+// Generated by rlefontconvert from Antonio-SemiBold.ttf, size 75, characters 48-58
+constexpr uint8_t Antonio_SemiBold75ptRLESpans[] PROGMEM = {
+   20,   0,  10,   1,  15,   1,  20,   1,  12,   2,  26,   1,  10,   3,  30,   1,
+    9,   4,  32,   1,   8,   5,  34,   1,   7,   6,  36,   1,   6,   7,  38,   1,
+    5,   8,  40,   2,   4,  10,  42,   2,   3,  12,  44,   2,   2,  14,  45,   1,
+    2,  15,  18,   1,  29,  15,  19,   1,  30,  16,  18,   1,   2,  16,  17,   2,
+   31,  17,  17,   1,  32,  18,  16,   2,   1,  18,  17,   3,  32,  20,  17,   2,
+    1,  21,  16,   5,   0,  26,  17,   4,   0,  30,  16,  69,   0,  99,  17,   3,
+   33,  22,  16,  85,   1, 102,  16,   7,  32, 107,  17,   2,   1, 109,  17,   1,
+   32, 109,  16,   2,   2, 110,  16,   2,  31, 111,  17,   2,   2, 112,  17,   2,
+   30, 113,  18,   1,   3, 114,  18,   1,  29, 114,  18,   1,   3, 115,  44,   2,
+    4, 117,  42,   2,   5, 119,  40,   2,   6, 121,  38,   1,   7, 122,  36,   2,
+    8, 124,  33,   1,  10, 125,  30,   1,  11, 126,  28,   1,  13, 127,  24,   1,
+   16, 128,  18,   1,  24, 129,   2,   1,  22,   0,  13,   1,  21,   1,  14,   2,
+   20,   3,  15,   2,  19,   5,  16,   1,  18,   6,  17,   1,  17,   7,  18,   1,
+   16,   8,  19,   1,  14,   9,  21,   1,  13,  10,  22,   1,  11,  11,  24,   1,
+    9,  12,  26,   1,   7,  13,  28,   1,   4,  14,  31,   1,   0,  15,  35,   7,
+    0,  22,  17,   1,   0,  23,  15,   1,   0,  24,  14,   1,   0,  25,  12,   1,
+    0,  26,   9,   1,   0,  27,   6,   1,  18,  22,  17, 104,  21,   0,   7,   1,
+   16,   1,  17,   1,  13,   2,  22,   1,  11,   3,  26,   1,  10,   4,  28,   1,
+    8,   5,  31,   1,   7,   6,  33,   1,   7,   7,  34,   1,   6,   8,  36,   1,
+    5,   9,  37,   1,   5,  10,  38,   1,   4,  11,  39,   1,   4,  12,  40,   1,
+    3,  13,  41,   1,   3,  14,  42,   1,   3,  15,  17,   1,  28,  15,  17,   1,
+   29,  16,  16,   1,   2,  16,  17,   2,  30,  17,  16,   3,   2,  18,  16,   2,
+    2,  20,  15,   1,  31,  20,  15,   2,   1,  21,  16,   5,  31,  22,  16,   5,
+    1,  26,  15,   3,  32,  27,  15,   8,  32,  35,  16,   1,  32,  36,  15,   4,
+   31,  40,  16,   7,  31,  47,  15,   1,   0,  29,  16,  23,  30,  48,  16,   4,
+   29,  52,  16,   3,  28,  55,  16,   2,  27,  57,  17,   1,  27,  58,  16,   1,
+   26,  59,  17,   1,  26,  60,  16,   1,  25,  61,  17,   1,  24,  62,  18,   1,
+   24,  63,  17,   1,  23,  64,  17,   2,  22,  66,  17,   1,  21,  67,  18,   1,
+   21,  68,  17,   1,  20,  69,  18,   1,  20,  70,  17,   1,  19,  71,  18,   1,
+   19,  72,  17,   1,  18,  73,  17,   1,  17,  74,  18,   1,  17,  75,  17,   1,
+   16,  76,  18,   1,  16,  77,  17,   1,  15,  78,  18,   1,  14,  79,  18,   2,
+   13,  81,  18,   1,  13,  82,  17,   1,  12,  83,  18,   1,  12,  84,  17,   1,
+   11,  85,  18,   1,  11,  86,  17,   1,  10,  87,  18,   1,  10,  88,  17,   1,
+    9,  89,  18,   1,   9,  90,  17,   1,   8,  91,  18,   1,   8,  92,  17,   1,
+    7,  93,  17,   2,   6,  95,  17,   2,   5,  97,  17,   2,   5,  99,  16,   1,
+    4, 100,  17,   2,   4, 102,  16,   1,   3, 103,  17,   2,   3, 105,  16,   2,
+    2, 107,  17,   1,   2, 108,  16,   5,   1, 113,  17,   1,   1, 114,  16,   1,
+    1, 115,  44,  13,  21,   0,   7,   1,  15,   1,  19,   1,  12,   2,  24,   1,
+   10,   3,  28,   1,   9,   4,  31,   1,   8,   5,  33,   1,   7,   6,  35,   1,
+    6,   7,  37,   1,   5,   8,  39,   1,   5,   9,  40,   1,   4,  10,  41,   1,
+    4,  11,  42,   1,   3,  12,  43,   1,   3,  13,  44,   1,   2,  14,  45,   1,
+    2,  15,  19,   1,  29,  15,  18,   1,   2,  16,  17,   1,  30,  16,  18,   1,
+    1,  17,  18,   1,  31,  17,  17,   1,  32,  18,  16,   1,   1,  18,  17,   2,
+   32,  19,  17,   2,   1,  20,  16,   3,   0,  23,  17,   1,  33,  21,  16,   4,
+   33,  25,  17,   2,   0,  24,  16,  13,  34,  27,  16,  12,  33,  39,  17,   2,
+   33,  41,  16,   5,  33,  46,  15,   1,  32,  47,  16,   3,  31,  50,  16,   2,
+   30,  52,  16,   1,  28,  53,  18,   1,  26,  54,  19,   1,  17,  55,  28,   1,
+   17,  56,  27,   1,  17,  57,  26,   1,  17,  58,  25,   1,  17,  59,  23,   1,
+   17,  60,  21,   2,  17,  62,  23,   1,  17,  63,  24,   1,  17,  64,  25,   1,
+   17,  65,  26,   1,  17,  66,  27,   1,  17,  67,  28,   1,  26,  68,  19,   1,
+   28,  69,  18,   1,  29,  70,  17,   1,  30,  71,  17,   1,  31,  72,  16,   1,
+   31,  73,  17,   1,  32,  74,  16,   3,  33,  77,  16,   5,  33,  82,  17,   2,
+   34,  84,  16,  17,   0,  87,  15,  15,  33, 101,  17,   4,   0, 102,  16,   5,
+   33, 105,  16,   3,   1, 107,  15,   2,  32, 108,  17,   2,  32, 110,  16,   1,
+    1, 109,  16,   3,  31, 111,  17,   2,   2, 112,  16,   1,   2, 113,  17,   1,
+   30, 113,  17,   1,   2, 114,  18,   1,  28, 114,  19,   1,   2, 115,  45,   1,
+    3, 116,  43,   2,   4, 118,  41,   2,   5, 120,  39,   1,   5, 121,  38,   1,
+    6, 122,  37,   1,   7, 123,  35,   1,   8, 124,  32,   1,   9, 125,  30,   1,
+   11, 126,  26,   1,  13, 127,  22,   1,  16, 128,  16,   1,  28,   0,  18,   1,
+   27,   1,  19,   4,  26,   5,  20,   3,  25,   8,  21,   3,  24,  11,  22,   3,
+   23,  14,  23,   4,  22,  18,  24,   3,  21,  21,  25,   3,  20,  24,  26,   3,
+   19,  27,  27,   2,  19,  29,  10,   2,  18,  31,  11,   2,  18,  33,  10,   1,
+   17,  34,  11,   2,  17,  36,  10,   1,  16,  37,  11,   3,  15,  40,  11,   4,
+   14,  44,  11,   3,  13,  47,  12,   1,  13,  48,  11,   2,  12,  50,  12,   1,
+   12,  51,  11,   3,  11,  54,  12,   1,  11,  55,  11,   2,  10,  57,  12,   2,
+   10,  59,  11,   1,   9,  60,  12,   3,   8,  63,  12,   3,   8,  66,  11,   1,
+    7,  67,  12,   3,   6,  70,  12,   3,   5,  73,  13,   1,   5,  74,  12,   2,
+    4,  76,  13,   2,   4,  78,  12,   2,   3,  80,  13,   2,   3,  82,  12,   1,
+    2,  83,  13,   2,   2,  85,  12,   1,  30,  29,  16,  60,   1,  86,  13,   3,
+    0,  89,  56,  14,  30, 103,  16,  23,   1,   0,  42,  15,  24,  37,   8,   1,
+   21,  38,  14,   1,  19,  39,  18,   1,  18,  40,  20,   1,   1,  15,  15,  27,
+   17,  41,  22,   1,   1,  42,  39,   1,   1,  43,  40,   2,   1,  45,  41,   2,
+    1,  47,  42,   3,   1,  50,  43,   1,   1,  51,  20,   1,  25,  51,  19,   1,
+    1,  52,  18,   1,  27,  52,  17,   1,   1,  53,  17,   1,  28,  53,  17,   1,
+    1,  54,  16,   2,  29,  54,  16,   3,  30,  57,  15,   2,   1,  56,  15,   4,
+    1,  60,  14,   3,   9,  63,   6,   1,  30,  59,  16,  46,  30, 105,  15,   3,
+    0,  88,  16,  21,  29, 108,  16,   3,   0, 109,  17,   2,   1, 111,  17,   1,
+   28, 111,  16,   1,   1, 112,  18,   1,  26, 112,  18,   1,   1, 113,  43,   1,
+    2, 114,  41,   3,   3, 117,  39,   2,   4, 119,  37,   1,   5, 120,  35,   1,
+    6, 121,  34,   1,   7, 122,  32,   1,   8, 123,  30,   1,  10, 124,  26,   1,
+   12, 125,  22,   1,  15, 126,  16,   1,  21,   0,   9,   1,  16,   1,  19,   1,
+   14,   2,  23,   1,  12,   3,  27,   1,  10,   4,  31,   1,   9,   5,  33,   1,
+    8,   6,  34,   1,   7,   7,  36,   1,   6,   8,  38,   2,   5,  10,  40,   2,
+    4,  12,  42,   2,   3,  14,  44,   1,   3,  15,  18,   1,  29,  15,  18,   1,
+    3,  16,  16,   1,  31,  16,  16,   2,   2,  17,  17,   1,  32,  18,  15,   1,
+    2,  18,  16,   3,  32,  19,  16,   2,   2,  21,  15,   1,  33,  21,  15,   8,
+    1,  22,  16,   8,   0,  30,  17,   3,  33,  29,  16,  10,  25,  49,   9,   1,
+   22,  50,  16,   1,  20,  51,  20,   1,  18,  52,  24,   1,   0,  33,  16,  21,
+   17,  53,  26,   1,   0,  54,  44,   1,   0,  55,  45,   2,   0,  57,  46,   1,
+    0,  58,  47,   3,   0,  61,  48,   2,   0,  63,  22,   1,  30,  63,  18,   1,
+    0,  64,  20,   1,  31,  64,  18,   1,   0,  65,  18,   1,  32,  65,  17,   1,
+    0,  66,  17,   2,  33,  66,  16,   2,  34,  68,  15,   1,  34,  69,  16,   3,
+   35,  72,  15,   6,   0,  68,  16,  30,   0,  98,  17,   2,  35,  78,  16,  23,
+    1, 100,  16,   7,  35, 101,  15,   6,   1, 107,  17,   2,  34, 107,  16,   2,
+    2, 109,  16,   2,  34, 109,  15,   2,   2, 111,  17,   1,  33, 111,  16,   2,
+    2, 112,  18,   1,   3, 113,  18,   1,  32, 113,  17,   1,   3, 114,  20,   1,
+   30, 114,  18,   1,   3, 115,  45,   1,   4, 116,  44,   1,   4, 117,  43,   1,
+    5, 118,  42,   1,   5, 119,  41,   1,   6, 120,  40,   1,   6, 121,  39,   1,
+    7, 122,  37,   1,   8, 123,  35,   1,   9, 124,  34,   1,  10, 125,  31,   1,
+   12, 126,  28,   1,  14, 127,  24,   1,  17, 128,  18,   1,  25, 129,   2,   1,
+    0,   0,  52,  14,  35,  14,  17,   1,  35,  15,  16,   2,  34,  17,  17,   1,
+   34,  18,  16,   2,  33,  20,  17,   1,  33,  21,  16,   1,  32,  22,  17,   2,
+   32,  24,  16,   1,  31,  25,  17,   1,  31,  26,  16,   2,  30,  28,  17,   1,
+   30,  29,  16,   2,  29,  31,  17,   1,  29,  32,  16,   2,  28,  34,  17,   1,
+   28,  35,  16,   2,  27,  37,  17,   1,  27,  38,  16,   2,  26,  40,  17,   1,
+   26,  41,  16,   2,  25,  43,  17,   1,  25,  44,  16,   2,  24,  46,  17,   1,
+   24,  47,  16,   3,  23,  50,  17,   1,  23,  51,  16,   2,  22,  53,  17,   1,
+   22,  54,  16,   2,  21,  56,  17,   2,  21,  58,  16,   2,  20,  60,  17,   2,
+   20,  62,  16,   1,  19,  63,  17,   2,  19,  65,  16,   1,  18,  66,  17,   4,
+   17,  70,  17,   4,  16,  74,  17,   4,  15,  78,  17,   4,  14,  82,  18,   1,
+   14,  83,  17,   4,  13,  87,  18,   2,  13,  89,  17,   2,  12,  91,  18,   3,
+   12,  94,  17,   3,  11,  97,  18,   4,  11, 101,  17,   1,  10, 102,  18,   6,
+   10, 108,  17,   1,   9, 109,  18,   9,   8, 118,  18,   8,  22,   0,   7,   1,
+   16,   1,  20,   1,  13,   2,  25,   1,  11,   3,  29,   1,   9,   4,  33,   1,
+    8,   5,  35,   1,   7,   6,  37,   1,   6,   7,  39,   2,   5,   9,  41,   1,
+    4,  10,  43,   2,   3,  12,  44,   1,   3,  13,  21,   1,  26,  13,  22,   1,
+    3,  14,  18,   1,  30,  14,  18,   1,   2,  15,  18,   1,  31,  15,  17,   1,
+    2,  16,  17,   2,  32,  16,  17,   2,   2,  18,  16,   1,  33,  18,  16,   2,
+    1,  19,  17,   2,  33,  20,  17,   2,   1,  21,  16,   6,   0,  27,  17,   9,
+   34,  22,  16,  21,   1,  36,  16,   8,  34,  43,  15,   1,   2,  44,  15,   2,
+   33,  44,  16,   4,   2,  46,  16,   2,   3,  48,  15,   1,  32,  48,  16,   3,
+    3,  49,  16,   2,   4,  51,  15,   1,  31,  51,  16,   1,   4,  52,  16,   1,
+   30,  52,  17,   1,   5,  53,  16,   1,  29,  53,  17,   1,   5,  54,  18,   1,
+   28,  54,  18,   1,   6,  55,  39,   1,   7,  56,  37,   1,   8,  57,  35,   1,
+    9,  58,  33,   1,  10,  59,  31,   1,   9,  60,  33,   1,   8,  61,  35,   1,
+    7,  62,  36,   1,   7,  63,  37,   1,   6,  64,  39,   1,   5,  65,  40,   1,
+    5,  66,  19,   1,  27,  66,  19,   1,   4,  67,  18,   1,  29,  67,  17,   1,
+    4,  68,  17,   1,  30,  68,  17,   1,   3,  69,  17,   2,  31,  69,  16,   2,
+    3,  71,  16,   1,   2,  72,  17,   1,  32,  71,  16,   3,   2,  73,  16,   2,
+    1,  75,  17,   1,  33,  74,  16,   4,   1,  76,  16,   4,  33,  78,  17,   3,
+    0,  80,  17,   4,  34,  81,  16,   7,   0,  84,  16,  16,  34,  88,  17,  13,
+    0, 100,  17,   1,   0, 101,  16,   2,  34, 101,  16,   6,   0, 103,  17,   5,
+   33, 107,  17,   3,   1, 108,  16,   2,  33, 110,  16,   1,   1, 110,  17,   2,
+   32, 111,  17,   2,   2, 112,  17,   1,   2, 113,  18,   1,  31, 113,  18,   1,
+    2, 114,  19,   1,  30, 114,  18,   1,   3, 115,  45,   1,   3, 116,  44,   2,
+    4, 118,  43,   1,   5, 119,  41,   1,   5, 120,  40,   1,   6, 121,  39,   1,
+    7, 122,  37,   1,   8, 123,  35,   1,   9, 124,  33,   1,  10, 125,  30,   1,
+   12, 126,  27,   1,  14, 127,  23,   1,  17, 128,  17,   1,  20,   0,  10,   1,
+   16,   1,  19,   1,  13,   2,  25,   1,  11,   3,  28,   1,  10,   4,  31,   1,
+    8,   5,  34,   1,   7,   6,  36,   1,   7,   7,  37,   1,   6,   8,  39,   1,
+    5,   9,  40,   1,   5,  10,  41,   1,   4,  11,  42,   1,   4,  12,  43,   1,
+    3,  13,  44,   1,   3,  14,  45,   1,   3,  15,  18,   1,  29,  15,  19,   1,
+    2,  16,  18,   1,  30,  16,  18,   1,   2,  17,  17,   1,  31,  17,  17,   1,
+    2,  18,  16,   2,  32,  18,  17,   2,   1,  20,  16,   4,  33,  20,  16,   5,
+   33,  25,  17,   1,   1,  24,  15,   6,   0,  30,  16,  21,   1,  51,  15,   6,
+    1,  57,  16,   3,   2,  60,  15,   2,  34,  26,  16,  38,   2,  62,  16,   2,
+    2,  64,  17,   1,  33,  64,  17,   1,   3,  65,  17,   1,  31,  65,  19,   1,
+    3,  66,  19,   1,  29,  66,  21,   1,   3,  67,  47,   1,   4,  68,  46,   3,
+    5,  71,  45,   1,   6,  72,  44,   2,   7,  74,  43,   1,   8,  75,  42,   1,
+    9,  76,  41,   1,  10,  77,  23,   1,  12,  78,  19,   1,  15,  79,  14,   1,
+    2,  91,  15,   7,  34,  77,  16,  26,   2,  98,  16,   7,  34, 103,  15,   3,
+    3, 105,  15,   5,  33, 106,  16,   4,  33, 110,  15,   1,   3, 110,  16,   2,
+   32, 111,  16,   2,   4, 112,  16,   1,   4, 113,  17,   1,  31, 113,  17,   1,
+    4, 114,  18,   1,  30, 114,  17,   1,   4, 115,  43,   1,   5, 116,  42,   1,
+    5, 117,  41,   2,   6, 119,  39,   1,   7, 120,  38,   1,   7, 121,  37,   1,
+    8, 122,  35,   1,   9, 123,  33,   1,  10, 124,  31,   1,  11, 125,  29,   1,
+   12, 126,  26,   1,  14, 127,  22,   1,  17, 128,  16,   1,   0,   0,  17,  19,
+    0,  56,  17,  19 };
+
+constexpr RLEglyph Antonio_SemiBold75ptRLEGlyphs[] PROGMEM = {
+  {     0,   46,   49,  130,   66,    8, -127 },    // 0x30 '0'
+  {    46,   21,   35,  126,   66,   11, -125 },    // 0x31 '1'
+  {    67,   82,   48,  128,   66,   10, -127 },    // 0x32 '2'
+  {   149,   86,   50,  129,   66,    8, -127 },    // 0x33 '3'
+  {   235,   43,   56,  126,   66,    6, -125 },    // 0x34 '4'
+  {   278,   44,   46,  127,   66,   10, -125 },    // 0x35 '5'
+  {   322,   78,   51,  130,   66,    8, -127 },    // 0x36 '6'
+  {   400,   51,   52,  126,   66,    7, -125 },    // 0x37 '7'
+  {   451,  100,   51,  129,   66,    7, -127 },    // 0x38 '8'
+  {   551,   76,   50,  129,   66,    6, -127 },    // 0x39 '9'
+  {   627,    2,   17,   75,   37,   10,  -93 } };   // 0x3A ':'
+
+constexpr RLEfont Antonio_SemiBold75ptRLE PROGMEM = {
+  Antonio_SemiBold75ptRLESpans,
+  Antonio_SemiBold75ptRLEGlyphs,
+  0x30, 0x3A, 190, 127, 130 };
+
+// Approx. 2626 bytes (629 spans)
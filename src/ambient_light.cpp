@@ -0,0 +1,103 @@
+#include <stdlib.h>
+#include <algorithm>
+#include <ambient_light.hpp>
+
+// Blocks this close to the filtered value count as settled: 1/32 of it, but at least half a count
+static int32_t settleBand(int32_t filtered_q8) {
+    return std::max(filtered_q8 >> LIGHT_SETTLE_SHIFT, 1 << 7);
+}
+
+// Takes a block of raw samples taken at time_us, which is reordered. Returns true if the brightness, dark or night
+// have changed
+bool AmbientLight::addBlock(uint16_t *samples, size_t samples_nr, int64_t time_us) {
+    if (samples_nr == 0)
+        return false;
+    // Oversampling with outlier rejection within the block: only the middle half of the samples is averaged. A zero
+    // is a valid sample, it is what the sensor returns in the dark
+    std::sort(samples, samples + samples_nr);
+    size_t first = samples_nr / 4;
+    size_t last = samples_nr - samples_nr / 4;
+    uint32_t sum = 0;
+    for (size_t s = first; s < last; s++) {
+        sum += samples[s];
+    }
+    int32_t value_q8 = (int32_t)(((uint64_t)sum << 8) / (last - first));
+
+    uint16_t brightness_before = state.brightness;
+    bool dark_before = state.dark;
+    bool night_before = state.night;
+
+    if (!state.valid) {
+        state.valid = true;
+        state.filtered_q8 = value_q8;
+    } else {
+        int32_t filtered_q8 = state.filtered_q8;
+        int32_t margin_q8 = LIGHT_OUTLIER_MARGIN << 8;
+        bool outlier = (value_q8 > filtered_q8 * LIGHT_OUTLIER_RATIO + margin_q8) ||
+                       (value_q8 * LIGHT_OUTLIER_RATIO + margin_q8 < filtered_q8);
+        if (abs(value_q8 - filtered_q8) <= settleBand(filtered_q8)) {
+            if (state.settled) {
+                // Only noise around the settled value, the backlight would flicker if it followed
+                state.blocks++;
+                state.outlier_blocks = 0;
+                return false;
+            }
+        } else if (change_start_us < 0) {
+            change_start_us = time_us;
+        }
+        if (outlier && state.outlier_blocks < LIGHT_OUTLIER_BLOCKS_MAX) {
+            state.outlier_blocks++;
+            state.outliers++;
+            state.settled = false;
+            return false;
+        }
+        if (outlier) {
+            // Not a flash, the light has really changed: there is no point in fading slowly towards it
+            state.filtered_q8 = value_q8;
+        } else {
+            state.filtered_q8 += (value_q8 - filtered_q8) / (1 << LIGHT_IIR_SHIFT);
+        }
+        state.outlier_blocks = 0;
+    }
+    state.blocks++;
+    state.settled = (abs(value_q8 - state.filtered_q8) <= settleBand(state.filtered_q8));
+    update(time_us);
+    return (state.brightness != brightness_before || state.dark != dark_before || state.night != night_before);
+}
+
+// Derives the outputs from the filter state
+void AmbientLight::update(int64_t time_us) {
+    state.lux_milli = toMilliLux(state.filtered_q8);
+    state.dark = (state.lux_milli < (state.dark ? LIGHT_ON_MLUX : LIGHT_OFF_MLUX));
+    state.night = (state.lux_milli < (state.night ? LIGHT_NIGHT_EXIT_MLUX : LIGHT_NIGHT_ENTER_MLUX));
+    state.brightness = state.dark ? 0 : curveBrightness(state.lux_milli);
+    if (state.settled && change_start_us >= 0) {
+        state.latency_us = time_us - change_start_us;
+        change_start_us = -1;
+    }
+}
+
+const light_state_t *AmbientLight::getState(void) {
+    return &state;
+}
+
+uint32_t AmbientLight::toMilliLux(int32_t raw_q8) {
+    if (raw_q8 <= 0)
+        return 0;
+    return (uint32_t)(((uint64_t)raw_q8 * LIGHT_ADC_FULL_SCALE_MV * 1000000) /
+                      ((uint64_t)LIGHT_ADC_MAX * LIGHT_SENSOR_UV_PER_LUX << 8));
+}
+
+uint16_t AmbientLight::curveBrightness(uint32_t lux_milli) {
+    if (lux_milli <= light_curve[0].lux_milli)
+        return light_curve[0].brightness;
+    for (size_t p = 1; p < LIGHT_CURVE_POINTS_NR; p++) {
+        const light_curve_point_t *from = &light_curve[p - 1];
+        const light_curve_point_t *to = &light_curve[p];
+        if (lux_milli < to->lux_milli) {
+            return from->brightness + ((lux_milli - from->lux_milli) * (to->brightness - from->brightness)) /
+                                          (to->lux_milli - from->lux_milli);
+        }
+    }
+    return light_curve[LIGHT_CURVE_POINTS_NR - 1].brightness;
+}
@@ -0,0 +1,77 @@
+#ifndef _INCLUDE_AMBIENT_LIGHT_HPP_
+#define _INCLUDE_AMBIENT_LIGHT_HPP_
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Calibration of the light sensor: ALS-PT19 on the Adafruit breakout (10 kOhm load, about 0.2 uA per lux), read by
+// ADC1 with ADC_ATTEN_DB_0
+#define LIGHT_ADC_MAX               4095
+#define LIGHT_ADC_FULL_SCALE_MV     750
+#define LIGHT_SENSOR_UV_PER_LUX     2000
+
+// Filter: the mean of the middle half of every block of samples goes through a low-pass filter, y += (x - y) / 2^shift
+#define LIGHT_IIR_SHIFT             2
+#define LIGHT_OUTLIER_RATIO         2    // Blocks beyond this factor of the filtered value (plus the margin) are
+#define LIGHT_OUTLIER_MARGIN        8    // outliers, e.g. a camera flash or car headlights. Once they last for more
+#define LIGHT_OUTLIER_BLOCKS_MAX    2    // blocks than this, they are taken as the new value without filtering
+#define LIGHT_SETTLE_SHIFT          5    // Settled once the blocks are within 1/32 of the filtered value
+
+// Hysteresis of the backlight being off and of the night palette, in millilux
+#define LIGHT_OFF_MLUX              2150
+#define LIGHT_ON_MLUX               2750
+#define LIGHT_NIGHT_ENTER_MLUX      2300
+#define LIGHT_NIGHT_EXIT_MLUX       3200
+
+typedef struct {
+    uint32_t lux_milli;
+    uint16_t brightness;  // 1/1000 of the full backlight duty
+} light_curve_point_t;
+
+// Backlight while it is on, interpolated linearly between the points. The first points match the brightness levels
+// the clock used to switch between
+constexpr light_curve_point_t light_curve[] = {
+    {2150, 4}, {2750, 6}, {5500, 39}, {7300, 80}, {9200, 196}, {11000, 300}, {16000, 392},
+};
+#define LIGHT_CURVE_POINTS_NR (sizeof(light_curve) / sizeof(light_curve[0]))
+
+constexpr bool lightCurveIsMonotonic(void) {
+    for (size_t p = 1; p < LIGHT_CURVE_POINTS_NR; p++) {
+        if (light_curve[p].lux_milli <= light_curve[p - 1].lux_milli ||
+            light_curve[p].brightness < light_curve[p - 1].brightness)
+            return false;
+    }
+    return true;
+}
+static_assert(lightCurveIsMonotonic(), "The light curve has to rise with the lux");
+
+typedef struct {
+    bool valid;            // At least one block has been accepted
+    int32_t filtered_q8;   // Filter state, ADC counts with 8 fractional bits
+    uint32_t lux_milli;    // Ambient light of the filtered value
+    uint16_t brightness;   // Backlight for this light, 0 while dark
+    bool dark;
+    bool night;
+    bool settled;          // The blocks agree with the filtered value, there is no need to sample any more
+    uint8_t outlier_blocks;  // Consecutive outliers rejected so far
+    uint32_t blocks;       // Blocks accepted ...
+    uint32_t outliers;     // ... and rejected as outliers since the start
+    int64_t latency_us;    // Last change: from the first block beyond the settled value until settled
+} light_state_t;
+
+// Turns raw samples of the light sensor into the backlight brightness. Nothing in here depends on ESP-IDF, so the
+// pipeline runs unchanged on the host, e.g. with recorded traces (see tools/light_replay)
+class AmbientLight {
+    light_state_t state = {};
+    int64_t change_start_us = -1;
+
+    void update(int64_t time_us);
+
+   public:
+    bool addBlock(uint16_t *samples, size_t samples_nr, int64_t time_us);
+    const light_state_t *getState(void);
+    static uint32_t toMilliLux(int32_t raw_q8);
+    static uint16_t curveBrightness(uint32_t lux_milli);
+};
+
+#endif // _INCLUDE_AMBIENT_LIGHT_HPP_
@@ -0,0 +1,45 @@
+#ifndef _INCLUDE_CLOCK_EVENTS_HPP_
+#define _INCLUDE_CLOCK_EVENTS_HPP_
+
+// Kept apart from clock_common.hpp, which the display includes as well: the display knows nothing of the encoder
+#include "freertos/FreeRTOS.h"
+#include <rotary_encoder.hpp>
+#include "clock_common.hpp"
+
+// Everything the main task reacts to is posted as an event into a single queue, the main task sleeps in between.
+// Events are posted without waiting, so that the esp_timer task, the interrupt handlers and the driver tasks are never
+// held up by the main task. An event which does not fit is dropped and counted (see ClockMachine::getDroppedEvents)
+#define CLOCK_EVENT_QUEUE_LENGTH     16
+
+// Timers of the states, see ClockTimers. A state change stops all of them
+typedef enum {
+    CLOCK_TIMER_BRIGHTNESS,     // End of the increased brightness
+    CLOCK_TIMER_BLINK,          // Blinking symbols and digits, alarm crescendo
+    CLOCK_TIMER_CANCEL_WINDOW,  // Time left to continue the snooze cancel sequence
+    CLOCK_TIMER_SNOOZE_TICK,    // Countdown of the snooze time
+    CLOCK_TIMERS_NR,
+} clock_timer_id_t;
+
+typedef enum {
+    CLOCK_EVENT_ENCODER,        // Rotation or button press
+    CLOCK_EVENT_TIMER,          // A timer of the state expired
+    CLOCK_EVENT_MINUTE,         // The minute of the time changed
+    CLOCK_EVENT_ALARM,          // The alarm time is reached
+    CLOCK_EVENT_TIME_SET,       // The time was synchronised, the minute may have changed
+    CLOCK_EVENT_WIFI_STATUS,
+    CLOCK_EVENT_MQTT_STATUS,
+    CLOCK_EVENT_AUDIO_STATUS,
+} clock_event_type_t;
+
+typedef struct {
+    clock_event_type_t type;
+    union {
+        rotary_encoder_event_t encoder;  // CLOCK_EVENT_ENCODER
+        struct {
+            clock_timer_id_t id;
+            uint32_t generation;         // Expiries of a timer which has been stopped or restarted since are ignored
+        } timer;                         // CLOCK_EVENT_TIMER
+    };
+} clock_event_t;
+
+#endif // _INCLUDE_CLOCK_EVENTS_HPP_
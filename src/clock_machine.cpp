@@ -1,3 +1,4 @@
+#include <sys/time.h>
 #include "nvs.h"
 #include "clock_machine.hpp"
 #include "clock_machine_states.hpp"
@@ -6,6 +7,29 @@
 static const char *TAG = "clock_machine";
 
 ClockMachine::ClockMachine(RotaryEncoder* encoder_ref) {
+    // All the modules post their events into this queue, so it has to exist before any of them is initialised
+    event_queue = xQueueCreate(CLOCK_EVENT_QUEUE_LENGTH, sizeof(clock_event_t));
+
+    timers.init(event_queue);
+
+    esp_timer_create_args_t minute_timer_args = {
+        .callback = minuteTimerCallback,
+        .arg = this,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "minute_timer",
+        .skip_unhandled_events = false,
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&minute_timer_args, &minute_timer));
+
+    esp_timer_create_args_t alarm_timer_args = {
+        .callback = alarmTimerCallback,
+        .arg = this,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "alarm_timer",
+        .skip_unhandled_events = false,
+    };
+    ESP_ERROR_CHECK(esp_timer_create(&alarm_timer_args, &alarm_timer));
+
     // This will retrieve all stored data from NVS
     if (readNVSValues() == ESP_ERR_NVS_NOT_FOUND) {
         // This is the fault we get when we try to read data which has not yet been written in the memory. In that case we accept that and rewrite
@@ -15,16 +39,20 @@ ClockMachine::ClockMachine(RotaryEncoder* encoder_ref) {
     }
 
     // Initialize the wifi + sntp stuff
-    wifi_time.init(&wifi_credentials);
+    wifi_time.init(&wifi_credentials, event_queue);
     wifi_time.getTime(&stored_time);
 
     display.init();
+    display.setDigitRoll(settings.rolling_digits);
+    display.setAnalogFace(settings.analog_face);
 
+    audio_player.setEventCallback(audioPlayerCallback, this);
     if (!audio_player.init(MP3_PLAYER_UART_PORT_NUM, MP3_PLAYER_TX, MP3_PLAYER_RX)) {
         ESP_LOGE(TAG, "There was an error initializing the MP3 player");
     }
 
     encoder = encoder_ref;
+    encoder->setEventCallback(encoderCallback, this);  // Before the encoder is initialised, see main
 
     // Upon clock start the alarm is always off
     display.updateContent(D_E_ALARM_TIME, &alarm_time, D_A_OFF);
@@ -36,8 +64,14 @@ ClockMachine::ClockMachine(RotaryEncoder* encoder_ref) {
     last_mqtt_connected_status = !wifi_time.isMQTTConnected();
     #endif
 
-    state = static_cast<ClockState*>(new TimeState());
-    state->enter(this);
+    std::get<CLOCK_STATE_TIME>(states).enter(this);
+
+    // The first event draws the status symbols, then the minute timer keeps the time up to date
+    armMinuteTimer();
+    updateNextAlarm();
+    clock_event_t event = {};
+    event.type = CLOCK_EVENT_MINUTE;
+    postEvent(&event, false);
 }
 
 esp_err_t ClockMachine::readNVSValues() {
@@ -87,11 +121,28 @@ void ClockMachine::saveWifiCredentialsInNVS() {
     nvs_close(NVS_handle);
 }
 
-void ClockMachine::setState(ClockState& newState) {
-    active_timer_us = 0;
-    state->exit(this);   // do stuff before we change state
-    state = &newState;   // change state
-    state->enter(this);  // do stuff after we change state
+// Calls the handler with the object of the current state, as its own type. Expands into one comparison per state,
+// no virtual calls. The state is read once: if the handler changes it, the handler of the new state must not be
+// called by the comparisons which follow
+template <typename Handler, size_t... I>
+void ClockMachine::dispatchTo(Handler handler, std::index_sequence<I...>) {
+    const clock_state_id_t current = state;
+    ((current == I ? handler(std::get<I>(states)) : void()), ...);
+}
+
+template <typename Handler>
+void ClockMachine::dispatch(Handler handler) {
+    dispatchTo(handler, std::make_index_sequence<CLOCK_STATES_NR>());
+}
+
+void ClockMachine::setState(clock_state_id_t new_state) {
+    // Everything drawn by exit and enter ends up on the screen as a single frame
+    display.beginFrame();
+    timers.stopAll();    // The timers started by exit and enter belong to the new state
+    dispatch([&](auto& s) { s.exit(this); });   // do stuff before we change state
+    state = new_state;                           // change state
+    dispatch([&](auto& s) { s.enter(this); });  // do stuff after we change state
+    display.endFrame();
 }
 
 void ClockMachine::checkTimeUpdate(void) {
@@ -103,6 +154,8 @@ void ClockMachine::checkTimeUpdate(void) {
         stored_time.hour = current_time.hour;
         stored_time.minute = current_time.minute;
         display.updateContent(D_E_TIME, &stored_time, D_A_ON);
+        // The CPU is awake for the time anyway, a settled ambient light is only sampled along with it
+        display.sampleAmbientLight();
         time_has_changed = true;
     }
     else {
@@ -110,22 +163,73 @@ void ClockMachine::checkTimeUpdate(void) {
     }
 }
 
-clock_time_t ClockMachine::getTimeToAlarm(clock_time_t current_time, clock_time_t alarm_time) {
-    clock_time_t time_to_alarm;
+time_t ClockMachine::getAlarmAfter(time_t after) {
+    // The same day at the alarm time, or the next day if that is not after it. mktime takes care of the DST: an alarm
+    // time within the hour skipped in spring is an hour later, one within the hour repeated in autumn the first of them
+    time_t alarm = after;
+    for (uint8_t day = 0; day < 2; day++) {
+        struct tm alarm_tm;
+        localtime_r(&after, &alarm_tm);
+        alarm_tm.tm_mday += day;
+        alarm_tm.tm_hour = alarm_time.hour;
+        alarm_tm.tm_min = alarm_time.minute;
+        alarm_tm.tm_sec = 0;
+        alarm_tm.tm_isdst = -1;
+        alarm = mktime(&alarm_tm);
+        if (alarm > after)
+            break;
+    }
+    return alarm;
+}
 
-    if (current_time.minute > alarm_time.minute) {
-        alarm_time.minute += 60;
-        current_time.hour++;
+void ClockMachine::updateNextAlarm(void) {
+    // Called when the alarm is switched, its time changed or it has rung
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    next_alarm = getAlarmAfter(now.tv_sec);
+
+    if (is_alarm_set) {
+        armAlarmTimer();
+    } else {
+        esp_timer_stop(alarm_timer);  // Fails harmlessly if it is not running
     }
-    if (current_time.hour > alarm_time.hour)
-        alarm_time.hour += 24;
+}
+
+clock_time_t ClockMachine::getTimeToAlarm(void) {
+    // Counted from the start of the current minute, as the time is shown, to the next time the alarm time is reached.
+    // It is the real time left, across a DST change an hour more or less than the difference of the clock times
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    time_t minute_start = now.tv_sec - now.tv_sec % 60;
+    time_t minutes = (getAlarmAfter(now.tv_sec) - minute_start) / 60;
 
-    time_to_alarm.hour = alarm_time.hour - current_time.hour;
-    time_to_alarm.minute = alarm_time.minute - current_time.minute;
+    clock_time_t time_to_alarm;
+    time_to_alarm.hour = (uint8_t)(minutes / 60);
+    time_to_alarm.minute = (uint8_t)(minutes % 60);
 
     return time_to_alarm;
 }
 
+void ClockMachine::checkAlarm(void) {
+    // Runs for every event, so an alarm is not missed when its timer event is lost or the time steps across it
+    if (!is_alarm_set)
+        return;
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    if (now.tv_sec < next_alarm)
+        return;
+    if (now.tv_sec - next_alarm > CLOCK_ALARM_MAX_DELAY_S) {
+        ESP_LOGW(TAG, "Alarm skipped, it was due %lld s ago", (long long)(now.tv_sec - next_alarm));
+        updateNextAlarm();
+        return;
+    }
+    // Only the time state rings. In the others the alarm stays due until the clock is back in the time state
+    bool ringing = false;
+    dispatch([&](auto& s) { ringing = s.alarmDue(this); });
+    if (ringing)
+        updateNextAlarm();  // Tomorrow's
+}
+
 WifiTime* ClockMachine::getWifiTime() {
     return &wifi_time;
 }
@@ -142,9 +246,86 @@ DFPlayer* ClockMachine::getPlayer() {
     return &audio_player;
 }
 
-void ClockMachine::triggerTimer(uint16_t timer_ms) {
-    active_timer_us = timer_ms * 1000;
-    trigger_timestamp_us = esp_timer_get_time();
+ClockTimers* ClockMachine::getTimers() {
+    return &timers;
+}
+
+QueueHandle_t ClockMachine::getEventQueue() {
+    return event_queue;
+}
+
+uint32_t ClockMachine::getDroppedEvents() {
+    return dropped_events + timers.getDroppedEvents() + wifi_time.getDroppedEvents();
+}
+
+// Returns true if a task of higher priority has been woken up, which only matters in an interrupt handler. Never
+// waits for room in the queue, see CLOCK_EVENT_QUEUE_LENGTH. A lost rotation still moves the encoder position
+bool ClockMachine::postEvent(const clock_event_t* event, bool in_isr) {
+    if (in_isr) {
+        BaseType_t higher_priority_task_woken = pdFALSE;
+        if (xQueueSendFromISR(event_queue, event, &higher_priority_task_woken) != pdTRUE)
+            dropped_events++;
+        return (higher_priority_task_woken == pdTRUE);
+    }
+    if (xQueueSend(event_queue, event, 0) != pdTRUE)
+        dropped_events++;
+    return false;
+}
+
+bool ClockMachine::encoderCallback(const rotary_encoder_event_t* encoder_event, bool in_isr, void* arg) {
+    ClockMachine* pThis = (ClockMachine*)arg;
+    clock_event_t event = {};
+    event.type = CLOCK_EVENT_ENCODER;
+    event.encoder = *encoder_event;
+    return pThis->postEvent(&event, in_isr);
+}
+
+void ClockMachine::audioPlayerCallback(dfplayer_event_t player_event, void* arg) {
+    ClockMachine* pThis = (ClockMachine*)arg;
+    // Any message of the player may change its online status, as does a player which stopped answering
+    clock_event_t event = {};
+    event.type = CLOCK_EVENT_AUDIO_STATUS;
+    pThis->postEvent(&event, false);
+}
+
+void ClockMachine::minuteTimerCallback(void* arg) {
+    // Runs in the esp_timer task, so the timer is re-armed by the main task when it handles the event
+    ClockMachine* pThis = (ClockMachine*)arg;
+    clock_event_t event = {};
+    event.type = CLOCK_EVENT_MINUTE;
+    pThis->postEvent(&event, false);
+}
+
+void ClockMachine::armMinuteTimer(void) {
+    // Computed from the time of day every minute, so the timer never drifts away from it. All time zones are
+    // whole minutes away from UTC. If the timer fires early, e.g. while SNTP adjusts the time, it simply fires again
+    // right after the full minute
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    uint64_t next_minute_us = (uint64_t)(60 - now.tv_sec % 60) * 1000000 - now.tv_usec + CLOCK_MINUTE_TIMER_MARGIN_US;
+    // Only armed by the main task. The timer may just have expired, then there is nothing to stop
+    esp_err_t err = esp_timer_stop(minute_timer);
+    if (err != ESP_ERR_INVALID_STATE)
+        ESP_ERROR_CHECK(err);
+    ESP_ERROR_CHECK(esp_timer_start_once(minute_timer, next_minute_us));
+}
+
+void ClockMachine::alarmTimerCallback(void* arg) {
+    ClockMachine* pThis = (ClockMachine*)arg;
+    clock_event_t event = {};
+    event.type = CLOCK_EVENT_ALARM;
+    pThis->postEvent(&event, false);
+}
+
+void ClockMachine::armAlarmTimer(void) {
+    // Only armed by the main task, the callback just posts the event
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    int64_t timeout_us = ((int64_t)next_alarm - now.tv_sec) * 1000000 - now.tv_usec + CLOCK_MINUTE_TIMER_MARGIN_US;
+    esp_err_t err = esp_timer_stop(alarm_timer);
+    if (err != ESP_ERR_INVALID_STATE)  // Not running
+        ESP_ERROR_CHECK(err);
+    ESP_ERROR_CHECK(esp_timer_start_once(alarm_timer, (timeout_us > 0) ? timeout_us : 0));
 }
 
 void ClockMachine::checkWifiStatus(bool force_update) {
@@ -156,14 +337,7 @@ void ClockMachine::checkWifiStatus(bool force_update) {
     }
 }
 
-void ClockMachine::run() {
-    if (active_timer_us > 0 && (esp_timer_get_time() - trigger_timestamp_us) > active_timer_us) {
-        active_timer_us = 0;
-        state->timerExpired(this);
-    } else {
-        checkTimeUpdate();
-        state->run(this);
-    }
+void ClockMachine::checkStatusSymbols(void) {
     // Keep track of wifi and mqtt status symbols
     checkWifiStatus(false);
     #ifdef MQTT_ACTIVE
@@ -186,14 +360,60 @@ void ClockMachine::run() {
     }
 }
 
-void ClockMachine::buttonShortPressed() {
-    state->buttonShortPressed(this);
-}
-
-void ClockMachine::buttonLongPressed() {
-    state->buttonLongPressed(this);
-}
-
-void ClockMachine::encoderRotated(rotary_encoder_pos_t position, rotary_encoder_dir_t direction) {
-    state->encoderRotated(this, position, direction);
+void ClockMachine::handleEvent(const clock_event_t* event) {
+    // Everything drawn for an event ends up on the screen as a single frame
+    display.beginFrame();
+    switch (event->type) {
+        case CLOCK_EVENT_ENCODER:
+            switch (event->encoder.type) {
+                case ENCODER_ROTATION:
+                    dispatch([&](auto& s) { s.encoderRotated(this, event->encoder.position, event->encoder.direction); });
+                    break;
+                case BUTTON_SHORT_PRESS:
+                    dispatch([&](auto& s) { s.buttonShortPressed(this); });
+                    break;
+                case BUTTON_LONG_PRESS:
+                    dispatch([&](auto& s) { s.buttonLongPressed(this); });
+                    break;
+            }
+            break;
+        case CLOCK_EVENT_TIMER:
+            // The timer may have expired just before it was restarted or stopped
+            if (timers.isCurrent(event))
+                dispatch([&](auto& s) { s.timerExpired(this, event->timer.id); });
+            break;
+        case CLOCK_EVENT_ALARM: {
+            // The timer fires early if the time has been adjusted since it was armed, checkAlarm rings when it is due
+            struct timeval now;
+            gettimeofday(&now, NULL);
+            if (is_alarm_set && now.tv_sec < next_alarm)
+                armAlarmTimer();
+            break;
+        }
+        case CLOCK_EVENT_TIME_SET:
+            // The time may have jumped, the minute and alarm timers have to follow. An alarm the time jumped across
+            // is still due and rings in checkAlarm, a step back does not ring it again
+            armMinuteTimer();
+            if (is_alarm_set)
+                armAlarmTimer();
+            break;
+        default:
+            // The minute and the status changes are picked up below
+            break;
+    }
+    // The minute timer expired, even if its event was lost in a full queue: then this runs for the events filling it
+    if (!esp_timer_is_active(minute_timer))
+        armMinuteTimer();
+    checkTimeUpdate();
+    dispatch([&](auto& s) { s.run(this); });
+    checkAlarm();  // After run, which may just have returned to the time state
+    checkStatusSymbols();
+    display.endFrame();
+
+    // Reported here, the posting side must not be held up by the log
+    uint32_t dropped = getDroppedEvents();
+    if (dropped != reported_dropped_events) {
+        ESP_LOGW(TAG, "%lu events lost, the event queue was full", (unsigned long)(dropped - reported_dropped_events));
+        reported_dropped_events = dropped;
+    }
 }
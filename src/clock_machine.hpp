@@ -1,7 +1,15 @@
 #ifndef _INCLUDE_CLOCK_MACHINE_HPP_
 #define _INCLUDE_CLOCK_MACHINE_HPP_
 
+#include <assert.h>
+#include <atomic>
+#include <time.h>
+#include <utility>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "esp_timer.h"
 #include "clock_machine_states.hpp"
+#include "clock_timers.hpp"
 #include <rotary_encoder.hpp>
 #include <wifi_time.hpp>
 #include <display.hpp>
@@ -12,26 +20,31 @@
 #define NVS_ALARM_MINUTE     "alarm_minute"
 #define NVS_WIFI_CREDENTIALS "credentials"
 
-// Forward declaration to resolve circular dependency/include
-class ClockState;
+// The minute and alarm timers fire this late after the full minute, so that the new minute is already there when it
+// is read
+#define CLOCK_MINUTE_TIMER_MARGIN_US 2000
+
+// An alarm which has not rung for longer than this after its time is skipped: the first time synchronisation after
+// boot, or the clock has been left in the WPS or alarm setting state for long
+#define CLOCK_ALARM_MAX_DELAY_S      (30 * 60)
 
 class ClockMachine {
   public:
     ClockMachine(RotaryEncoder* encoder_ref);
     void saveAlarmTimeInNVS();
     void saveWifiCredentialsInNVS();
-    void setState(ClockState& newState);
-    clock_time_t getTimeToAlarm(clock_time_t current_time, clock_time_t alarm_time);
+    template <clock_trigger_t trigger, typename State> void transition(const State* from);
+    void updateNextAlarm(void);
+    clock_time_t getTimeToAlarm(void);
     WifiTime* getWifiTime();
     Display* getDisplay();
     RotaryEncoder* getEncoder();
     DFPlayer* getPlayer();
-    void triggerTimer(uint16_t timer_ms);
+    ClockTimers* getTimers();
     void checkWifiStatus(bool force_update);
-    void run();
-    void buttonShortPressed();
-    void buttonLongPressed();
-    void encoderRotated(rotary_encoder_pos_t position, rotary_encoder_dir_t direction);
+    QueueHandle_t getEventQueue();
+    uint32_t getDroppedEvents();
+    void handleEvent(const clock_event_t* event);
     ~ClockMachine();
 
     clock_time_t stored_time;
@@ -44,20 +57,41 @@ class ClockMachine {
         uint16_t snooze_time_s = 300;     // Snooze time in seconds (must be a factor of 5!)
         bool alarm_set_confirmation_sound = false;
         uint8_t melody_nr = 1;
+        bool rolling_digits = false;      // Animate the changing digits of the time
+        bool analog_face = false;         // Show the time on an analog face instead of the digits
     } settings;
 
   private:
     esp_err_t readNVSValues();
     void writeNVSDefaultValues();
     void checkTimeUpdate(void);
+    void setState(clock_state_id_t new_state);
+    template <typename Handler> void dispatch(Handler handler);
+    template <typename Handler, size_t... I> void dispatchTo(Handler handler, std::index_sequence<I...>);
+    void checkStatusSymbols(void);
+    bool postEvent(const clock_event_t* event, bool in_isr);
+    void armMinuteTimer(void);
+    void armAlarmTimer(void);
+    time_t getAlarmAfter(time_t after);
+    void checkAlarm(void);
+    static bool encoderCallback(const rotary_encoder_event_t* encoder_event, bool in_isr, void* arg);
+    static void audioPlayerCallback(dfplayer_event_t player_event, void* arg);
+    static void minuteTimerCallback(void* arg);
+    static void alarmTimerCallback(void* arg);
 
-    ClockState* state;
+    clock_states_t states;
+    clock_state_id_t state = CLOCK_STATE_TIME;
     WifiTime wifi_time;
     Display display;
     RotaryEncoder* encoder;
     DFPlayer audio_player;
-    int64_t active_timer_us;
-    int64_t trigger_timestamp_us;
+    QueueHandle_t event_queue;
+    std::atomic<uint32_t> dropped_events{0};  // Posted by the interrupt handler, the timers and the driver tasks
+    uint32_t reported_dropped_events = 0;
+    ClockTimers timers;
+    esp_timer_handle_t minute_timer;
+    esp_timer_handle_t alarm_timer;
+    time_t next_alarm = 0;  // When the alarm rings next. Stays in the past while a due alarm waits for the time state
     wifi_credentials_t wifi_credentials;
     bool last_wifi_connected_status;
     bool last_audio_online_status;
@@ -66,4 +100,14 @@ class ClockMachine {
     #endif
 };
 
+// Changes to the state the transition table has for the trigger in the current state. A trigger which the table
+// does not have for this state does not compile
+template <clock_trigger_t trigger, typename State>
+void ClockMachine::transition(const State* from) {
+    constexpr int8_t to = clockTransitionTarget(State::id, trigger);
+    static_assert(to >= 0, "The transition table has no such trigger for this state");
+    assert(state == State::id);
+    setState((clock_state_id_t)to);
+}
+
 #endif /* _INCLUDE_CLOCK_MACHINE_HPP_ */
\ No newline at end of file
@@ -1,87 +1,78 @@
 #include "clock_machine_states.hpp"
+#include "clock_machine.hpp"
 
 //--------------//
 //  TIME STATE  //
 //--------------//
 
-ClockState& TimeState::getInstance() {
-    static TimeState singleton;
-    return singleton;
-}
-
 void TimeState::enter(ClockMachine* clock) {
     clock->getDisplay()->updateContent(D_E_TIME, &clock->stored_time, D_A_ON);
 }
 
 void TimeState::run(ClockMachine* clock) {
-    if (clock->is_alarm_set &&
-        (clock->stored_time.hour == clock->alarm_time.hour) &&
-        (clock->stored_time.minute == clock->alarm_time.minute)) {
-        clock_time_t bed_time = clock->getTimeToAlarm(clock->stored_time, clock->alarm_time);
-        clock->getDisplay()->updateContent(D_E_BED_TIME, &bed_time, D_A_OFF);
-        clock->setState(AlarmState::getInstance());
-    }
-    else if (clock->is_alarm_set && clock->time_has_changed)
-    {
-        clock_time_t bed_time = clock->getTimeToAlarm(clock->stored_time, clock->alarm_time);
+    // The bed time counts down with the minutes
+    if (clock->is_alarm_set && clock->time_has_changed) {
+        clock_time_t bed_time = clock->getTimeToAlarm();
         clock->getDisplay()->updateContent(D_E_BED_TIME, &bed_time, D_A_ON);
     }
-    
 }
 
-void TimeState::timerExpired(ClockMachine* clock) {
-    clock->getDisplay()->setIncreasedBrightness(false);
+void TimeState::timerExpired(ClockMachine* clock, clock_timer_id_t timer) {
+    // Also started by the states leaving to this one
+    if (timer == CLOCK_TIMER_BRIGHTNESS)
+        clock->getDisplay()->setIncreasedBrightness(false);
+}
+
+bool TimeState::alarmDue(ClockMachine* clock) {
+    clock_time_t bed_time = clock->getTimeToAlarm();
+    clock->getDisplay()->updateContent(D_E_BED_TIME, &bed_time, D_A_OFF);
+    clock->transition<CLOCK_TRIGGER_ALARM_DUE>(this);
+    return true;
 }
 
 void TimeState::buttonShortPressed(ClockMachine* clock) {
     if (clock->getDisplay()->isDisplayOn()) {
         // Invert the alarm state but only if the display was already on
         clock->is_alarm_set = !clock->is_alarm_set;
+        clock->updateNextAlarm();
         display_action_t action = clock->is_alarm_set ? D_A_ON : D_A_OFF;        
         clock->getDisplay()->updateContent(D_E_ALARM_TIME, &clock->alarm_time, action);
-        clock_time_t bed_time = clock->getTimeToAlarm(clock->stored_time, clock->alarm_time);
+        clock_time_t bed_time = clock->getTimeToAlarm();
         clock->getDisplay()->updateContent(D_E_BED_TIME, &bed_time, action);
     }
     clock->getDisplay()->setIncreasedBrightness(true);
-    clock->triggerTimer(3000);
+    clock->getTimers()->startOnce(CLOCK_TIMER_BRIGHTNESS, BRIGHTNESS_BOOST_MS);
 }
 
 void TimeState::buttonLongPressed(ClockMachine* clock) {
-    clock->setState(SetAlarmState::getInstance());
+    clock->transition<CLOCK_TRIGGER_SET_ALARM>(this);
 }
 
 void TimeState::encoderRotated(ClockMachine* clock, rotary_encoder_pos_t position, rotary_encoder_dir_t direction) {
     // If wifi is already connected, just use this as a temporary brightness increaser. Otherwise go to Wifi WPS setting state
     if (clock->getWifiTime()->isWifiConnected()) {
         clock->getDisplay()->setIncreasedBrightness(true);
-        clock->triggerTimer(3000);
+        clock->getTimers()->startOnce(CLOCK_TIMER_BRIGHTNESS, BRIGHTNESS_BOOST_MS);
     } else {
-        clock->setState(WPSState::getInstance());
+        clock->transition<CLOCK_TRIGGER_WIFI_SETUP>(this);
     }
 }
 
 void TimeState::exit(ClockMachine* clock) {
 }
 
-TimeState::~TimeState() {}
-
 
 //-------------//
 //  WPS STATE  //
 //-------------//
 
-ClockState& WPSState::getInstance() {
-    static WPSState singleton;
-    return singleton;
-}
-
 void WPSState::enter(ClockMachine* clock) {
     clock->getDisplay()->updateContent(D_E_BED_TIME, &(clock->alarm_time), D_A_OFF); // alarm time as dummy value
     blink = true;
     clock->getDisplay()->updateContent(D_E_WIFI_SETTING, D_A_ON);
     clock->getDisplay()->setIncreasedBrightness(true);
     clock->getWifiTime()->startWPS();
-    clock->triggerTimer(500);
+    clock->getTimers()->startPeriodic(CLOCK_TIMER_BLINK, BLINK_PERIOD_MS);
 }
 
 void WPSState::run(ClockMachine* clock) {
@@ -89,63 +80,47 @@ void WPSState::run(ClockMachine* clock) {
     if (clock->getWifiTime()->isWifiConnected()) {
         // Save the acquired credentials in NVS
         clock->saveWifiCredentialsInNVS();
-        clock->setState(TimeState::getInstance());
+        clock->transition<CLOCK_TRIGGER_WIFI_CONNECTED>(this);
     }
 }
 
-void WPSState::timerExpired(ClockMachine* clock) {
+void WPSState::timerExpired(ClockMachine* clock, clock_timer_id_t timer) {
     blink = !blink;
     display_action_t action = blink ? D_A_ON : D_A_OFF;
     clock->getDisplay()->updateContent(D_E_WIFI_SETTING, action);
-    clock->triggerTimer(500);
-}
-
-void WPSState::buttonShortPressed(ClockMachine* clock) {
-}
-
-void WPSState::buttonLongPressed(ClockMachine* clock) {
 }
 
 void WPSState::encoderRotated(ClockMachine* clock, rotary_encoder_pos_t position, rotary_encoder_dir_t direction) {
     clock->getWifiTime()->stopWPS();
-    clock->setState(TimeState::getInstance());
+    clock->transition<CLOCK_TRIGGER_CANCEL>(this);
 }
 
 void WPSState::exit(ClockMachine* clock) {
     clock->getDisplay()->updateContent(D_E_WIFI_SETTING, D_A_OFF);
     display_action_t action = clock->is_alarm_set ? D_A_ON : D_A_OFF;  
-    clock_time_t bed_time = clock->getTimeToAlarm(clock->stored_time, clock->alarm_time);
+    clock_time_t bed_time = clock->getTimeToAlarm();
     clock->getDisplay()->updateContent(D_E_BED_TIME, &bed_time, action);
     clock->checkWifiStatus(true);
 }
 
-WPSState::~WPSState() {}
-
 
 //---------------//
 //  ALARM STATE  //
 //---------------//
 
-ClockState& AlarmState::getInstance() {
-    static AlarmState singleton;
-    return singleton;
-}
-
 void AlarmState::enter(ClockMachine* clock) {
     clock->getDisplay()->setMaxBrightness(true);
     alarm_volume = 4;
     crescendo_counter = clock->settings.crescendo_factor;   // To force setting the volume in the next trigger
     clock->getPlayer()->loopTrack(clock->settings.melody_nr);
-    clock->triggerTimer(10);  // Short trigger to avoid copying code that will be in the timerExpired method
+    clock->getTimers()->startPeriodic(CLOCK_TIMER_BLINK, BLINK_PERIOD_MS);
+    timerExpired(clock, CLOCK_TIMER_BLINK);  // The first step right away
     #ifdef MQTT_ACTIVE
     clock->getWifiTime()->sendMQTTAlarmTriggered();
     #endif
 }
 
-void AlarmState::run(ClockMachine* clock) {
-}
-
-void AlarmState::timerExpired(ClockMachine* clock) {
+void AlarmState::timerExpired(ClockMachine* clock, clock_timer_id_t timer) {
     if (crescendo_counter == clock->settings.crescendo_factor) {
         crescendo_counter = 0;
         if (alarm_volume < 30) {
@@ -154,7 +129,6 @@ void AlarmState::timerExpired(ClockMachine* clock) {
         }
     }
     crescendo_counter++;
-    clock->triggerTimer(500);
 
     display_action_t action;
     action = alarm_symbol_direction ? D_A_OFF : D_A_ON;
@@ -163,13 +137,7 @@ void AlarmState::timerExpired(ClockMachine* clock) {
 }
 
 void AlarmState::buttonShortPressed(ClockMachine* clock) {
-    clock->setState(SnoozeState::getInstance());
-}
-
-void AlarmState::buttonLongPressed(ClockMachine* clock) {
-}
-
-void AlarmState::encoderRotated(ClockMachine* clock, rotary_encoder_pos_t position, rotary_encoder_dir_t direction) {
+    clock->transition<CLOCK_TRIGGER_SNOOZE>(this);
 }
 
 void AlarmState::exit(ClockMachine* clock) {
@@ -178,60 +146,64 @@ void AlarmState::exit(ClockMachine* clock) {
     clock->getDisplay()->updateContent(D_E_ALARM_TIME, &clock->alarm_time, D_A_ON);
 }
 
-AlarmState::~AlarmState() {}
-
 
 //----------------//
 //  SNOOZE STATE  //
 //----------------//
 
-ClockState& SnoozeState::getInstance() {
-    static SnoozeState singleton;
-    return singleton;
-}
-
 void SnoozeState::enter(ClockMachine* clock) {
     snooze_leaving_step = SNOOZE_WAITING;
     clock->getDisplay()->setIncreasedBrightness(true);
-    clock->triggerTimer(3000);  // To show the time 3 seconds after snoozing
-    snooze_start_timer_s = (int64_t)(esp_timer_get_time() / 1000000);
+    clock->getTimers()->startOnce(CLOCK_TIMER_BRIGHTNESS, BRIGHTNESS_BOOST_MS);  // To show the time 3 seconds after snoozing
     remaining_snooze_time_s = clock->settings.snooze_time_s;
-}
-
-void SnoozeState::run(ClockMachine* clock) {
-    int64_t now_s = (int64_t)(esp_timer_get_time() / 1000000);
-    uint16_t snooze_time_left_s = (uint16_t)(clock->settings.snooze_time_s - now_s + snooze_start_timer_s);
-    if (snooze_time_left_s < remaining_snooze_time_s) {
-        if (snooze_time_left_s == 0) {
-            clock->setState(AlarmState::getInstance());
-        } else {
-            remaining_snooze_time_s = snooze_time_left_s;
-            clock->getDisplay()->updateContent(D_E_SNOOZE_TIME, &snooze_time_left_s, D_A_ON);
-        }
+    clock->getTimers()->startPeriodic(CLOCK_TIMER_SNOOZE_TICK, SNOOZE_TICK_MS);
+}
+
+void SnoozeState::timerExpired(ClockMachine* clock, clock_timer_id_t timer) {
+    switch (timer) {
+        case CLOCK_TIMER_BRIGHTNESS:
+            clock->getDisplay()->setIncreasedBrightness(false);
+            break;
+        case CLOCK_TIMER_CANCEL_WINDOW:
+            // Back to the start position for the snooze cancel sequence
+            snooze_leaving_step = SNOOZE_WAITING;
+            clock->getDisplay()->updateContent(D_E_SNOOZE_CANCEL, D_A_OFF);
+            break;
+        case CLOCK_TIMER_SNOOZE_TICK:
+            remaining_snooze_time_s--;
+            if (remaining_snooze_time_s == 0) {
+                clock->transition<CLOCK_TRIGGER_SNOOZE_OVER>(this);
+            } else {
+                clock->getDisplay()->updateContent(D_E_SNOOZE_TIME, &remaining_snooze_time_s, D_A_ON);
+            }
+            break;
+        default:
+            break;
     }
 }
 
-void SnoozeState::timerExpired(ClockMachine* clock) {
-    clock->getDisplay()->setIncreasedBrightness(false);
-    snooze_leaving_step = SNOOZE_WAITING;
-    clock->getDisplay()->updateContent(D_E_SNOOZE_CANCEL, D_A_OFF);
-    // Back to the start position for the snooze cancel sequence
-}
-
 void SnoozeState::buttonShortPressed(ClockMachine* clock) {
+    if (snooze_leaving_step != SNOOZE_WAITING) {
+        // Not a step of the cancel sequence, but it keeps the window alive
+        clock->getTimers()->startOnce(CLOCK_TIMER_CANCEL_WINDOW, CANCEL_WINDOW_MS);
+    }
     clock->getDisplay()->setIncreasedBrightness(true);
-    clock->triggerTimer(3000);
+    clock->getTimers()->startOnce(CLOCK_TIMER_BRIGHTNESS, BRIGHTNESS_BOOST_MS);
 }
 
 void SnoozeState::buttonLongPressed(ClockMachine* clock) {
     if (snooze_leaving_step == SNOOZE_FIRST_ROTATION) {
         snooze_leaving_step = SNOOZE_LONG_PRESS;
         clock->getDisplay()->updateContent(D_E_SNOOZE_CANCEL, D_A_TWO_BARS);
+        clock->getTimers()->startOnce(CLOCK_TIMER_CANCEL_WINDOW, CANCEL_WINDOW_MS);
         //Yes! Now a rotation in the other direction!!!
+    } else if (snooze_leaving_step != SNOOZE_WAITING) {
+        // In the middle of the sequence, keep the window alive
+        clock->getTimers()->startOnce(CLOCK_TIMER_CANCEL_WINDOW, CANCEL_WINDOW_MS);
     }
     // No matter in what state are we, 3 seconds more light.
     clock->getDisplay()->setIncreasedBrightness(true);
-    clock->triggerTimer(3000);
+    clock->getTimers()->startOnce(CLOCK_TIMER_BRIGHTNESS, BRIGHTNESS_BOOST_MS);
 }
 
 void SnoozeState::encoderRotated(ClockMachine* clock, rotary_encoder_pos_t position, rotary_encoder_dir_t direction) {
@@ -239,55 +211,50 @@ void SnoozeState::encoderRotated(ClockMachine* clock, rotary_encoder_pos_t posit
         snooze_leaving_step = SNOOZE_FIRST_ROTATION;
         first_rotation_dir = direction;
         clock->getDisplay()->updateContent(D_E_SNOOZE_CANCEL, D_A_ONE_BAR);
+        clock->getTimers()->startOnce(CLOCK_TIMER_CANCEL_WINDOW, CANCEL_WINDOW_MS);
         // Now a long press...
     } else if (snooze_leaving_step == SNOOZE_LONG_PRESS and direction != first_rotation_dir) {
         // Yes! Snooze cancellation sequence complete!
         clock->getDisplay()->updateContent(D_E_SNOOZE_CANCEL, D_A_OFF);
         clock->is_alarm_set = false;
+        clock->updateNextAlarm();
         clock->getDisplay()->updateContent(D_E_ALARM_TIME, &clock->alarm_time, D_A_OFF);
         #ifdef MQTT_ACTIVE
         clock->getWifiTime()->sendMQTTAlarmStopped();
         #endif
-        clock->setState(TimeState::getInstance());
+        clock->transition<CLOCK_TRIGGER_ALARM_OFF>(this);
+    } else {
+        // Otherwise we are in the middle of the sequence, keep the window alive
+        clock->getTimers()->startOnce(CLOCK_TIMER_CANCEL_WINDOW, CANCEL_WINDOW_MS);
     }
 
-    // Otherwise we are in the first rotation step, keep the window alive.
     // In any case, even if we leave the snooze state, 3 seconds more light
     clock->getDisplay()->setIncreasedBrightness(true);
-    clock->triggerTimer(3000);
+    clock->getTimers()->startOnce(CLOCK_TIMER_BRIGHTNESS, BRIGHTNESS_BOOST_MS);
 }
 
 void SnoozeState::exit(ClockMachine* clock) {
     clock->getDisplay()->updateContent(D_E_SNOOZE_TIME, NULL, D_A_OFF);
 }
 
-SnoozeState::~SnoozeState() {}
 
 //-------------------//
 //  SET ALARM STATE  //
 //-------------------//
 
-ClockState& SetAlarmState::getInstance() {
-    static SetAlarmState singleton;
-    return singleton;
-}
-
 void SetAlarmState::enter(ClockMachine* clock) {
     clock->getDisplay()->setIncreasedBrightness(true);
     clock->getDisplay()->updateContent(D_E_ALARM_TIME, &clock->alarm_time, D_A_HIDE_HOURS);
     hours_hidden = true;
     setting_minutes = false;  // We begin with the hours
-    clock->triggerTimer(500);
+    clock->getTimers()->startPeriodic(CLOCK_TIMER_BLINK, BLINK_PERIOD_MS);
     clock->getEncoder()->setRange(0, 23, true, true);
     clock->getEncoder()->setPosition(clock->alarm_time.hour);
     original_alarm_time.hour = clock->alarm_time.hour;
     original_alarm_time.minute = clock->alarm_time.minute;
 }
 
-void SetAlarmState::run(ClockMachine* clock) {
-}
-
-void SetAlarmState::timerExpired(ClockMachine* clock) {
+void SetAlarmState::timerExpired(ClockMachine* clock, clock_timer_id_t timer) {
     display_action_t action;
 
     if (!setting_minutes) {
@@ -300,7 +267,6 @@ void SetAlarmState::timerExpired(ClockMachine* clock) {
         minutes_hidden = !minutes_hidden;
     }
     clock->getDisplay()->updateContent(D_E_ALARM_TIME, &clock->alarm_time, action);
-    clock->triggerTimer(500);
 }
 
 void SetAlarmState::buttonShortPressed(ClockMachine* clock) {
@@ -308,11 +274,11 @@ void SetAlarmState::buttonShortPressed(ClockMachine* clock) {
         clock->getDisplay()->updateContent(D_E_ALARM_TIME, &clock->alarm_time, D_A_HIDE_MINUTES);
         minutes_hidden = true;
         setting_minutes = true;  // It's turn for the minutes now
-        clock->triggerTimer(500);
+        clock->getTimers()->startPeriodic(CLOCK_TIMER_BLINK, BLINK_PERIOD_MS);
         clock->getEncoder()->setRange(0, 59, true, true);
         clock->getEncoder()->setPosition(clock->alarm_time.minute);
     } else {
-        clock->setState(TimeState::getInstance());
+        clock->transition<CLOCK_TRIGGER_ALARM_SET>(this);
     }
 }
 
@@ -320,7 +286,7 @@ void SetAlarmState::buttonLongPressed(ClockMachine* clock) {
     // Cancel the alarm setting and restore the original times
     clock->alarm_time.hour = original_alarm_time.hour;
     clock->alarm_time.minute = original_alarm_time.minute;
-    clock->setState(TimeState::getInstance());
+    clock->transition<CLOCK_TRIGGER_CANCEL>(this);
 }
 
 void SetAlarmState::encoderRotated(ClockMachine* clock, rotary_encoder_pos_t position, rotary_encoder_dir_t direction) {
@@ -333,22 +299,27 @@ void SetAlarmState::encoderRotated(ClockMachine* clock, rotary_encoder_pos_t pos
         minutes_hidden = false;
     }
     clock->getDisplay()->updateContent(D_E_ALARM_TIME, &clock->alarm_time, D_A_ON);
-    clock_time_t bed_time = clock->getTimeToAlarm(clock->stored_time, clock->alarm_time);
+    clock_time_t bed_time = clock->getTimeToAlarm();
     clock->getDisplay()->updateContent(D_E_BED_TIME, &bed_time, D_A_ON);
 
-    clock->triggerTimer(500);
+    // Blinking starts over, the new time is shown for a full period
+    clock->getTimers()->startPeriodic(CLOCK_TIMER_BLINK, BLINK_PERIOD_MS);
 }
 
 void SetAlarmState::exit(ClockMachine* clock) {
     clock->getDisplay()->updateContent(D_E_ALARM_TIME, &clock->alarm_time, D_A_ON);
+    // An alarm which has become due meanwhile still rings if its time has not been changed
+    bool alarm_changed = !clock->is_alarm_set || (clock->alarm_time.hour != original_alarm_time.hour) ||
+                         (clock->alarm_time.minute != original_alarm_time.minute);
     clock->is_alarm_set = true;  // After setting the new alarm time alarm is set
+    if (alarm_changed)
+        clock->updateNextAlarm();
     clock->saveAlarmTimeInNVS();
 
     if (clock->settings.alarm_set_confirmation_sound) {
         clock->getPlayer()->setVolume(10);
         clock->getPlayer()->playTrack(CONFIRMATION_TRACK);
     }
-    clock->triggerTimer(3000);  // To show the new alarm time at least 3 seconds
+    // To show the new alarm time at least 3 seconds, handled by the time state
+    clock->getTimers()->startOnce(CLOCK_TIMER_BRIGHTNESS, BRIGHTNESS_BOOST_MS);
 }
-
-SetAlarmState::~SetAlarmState() {}
@@ -1,51 +1,135 @@
 #ifndef _INCLUDE_CLOCK_MACHINE_STATES_HPP_
 #define _INCLUDE_CLOCK_MACHINE_STATES_HPP_
 
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <rotary_encoder.hpp>
-#include <wifi_time.hpp>
-#include "clock_machine.hpp"
+#include "clock_events.hpp"
 
 #define CONFIRMATION_TRACK  101
 
+#define BRIGHTNESS_BOOST_MS 3000  // Increased brightness after the last input
+#define BLINK_PERIOD_MS     500
+#define CANCEL_WINDOW_MS    3000  // Time for each step of the snooze cancel sequence
+#define SNOOZE_TICK_MS      1000
+
 // Forward declaration to resolve circular dependency/include
 class ClockMachine;
 
+typedef enum {
+    CLOCK_STATE_TIME,  // Initial state
+    CLOCK_STATE_WPS,
+    CLOCK_STATE_ALARM,
+    CLOCK_STATE_SNOOZE,
+    CLOCK_STATE_SET_ALARM,
+    CLOCK_STATES_NR,
+} clock_state_id_t;
+
+// What makes a state hand over to another one. The state decides when it happened, the table below where it leads
+typedef enum {
+    CLOCK_TRIGGER_ALARM_DUE,       // The alarm time is reached
+    CLOCK_TRIGGER_SET_ALARM,       // Long press
+    CLOCK_TRIGGER_WIFI_SETUP,      // Rotation while WiFi is not connected
+    CLOCK_TRIGGER_WIFI_CONNECTED,
+    CLOCK_TRIGGER_CANCEL,
+    CLOCK_TRIGGER_SNOOZE,          // Short press during the alarm
+    CLOCK_TRIGGER_SNOOZE_OVER,
+    CLOCK_TRIGGER_ALARM_OFF,       // Snooze cancel sequence complete
+    CLOCK_TRIGGER_ALARM_SET,       // New alarm time confirmed
+} clock_trigger_t;
+
+typedef struct {
+    clock_state_id_t from;
+    clock_trigger_t trigger;
+    clock_state_id_t to;
+} clock_transition_t;
+
+constexpr clock_transition_t clock_transitions[] = {
+    {CLOCK_STATE_TIME, CLOCK_TRIGGER_ALARM_DUE, CLOCK_STATE_ALARM},
+    {CLOCK_STATE_TIME, CLOCK_TRIGGER_SET_ALARM, CLOCK_STATE_SET_ALARM},
+    {CLOCK_STATE_TIME, CLOCK_TRIGGER_WIFI_SETUP, CLOCK_STATE_WPS},
+    {CLOCK_STATE_WPS, CLOCK_TRIGGER_WIFI_CONNECTED, CLOCK_STATE_TIME},
+    {CLOCK_STATE_WPS, CLOCK_TRIGGER_CANCEL, CLOCK_STATE_TIME},
+    {CLOCK_STATE_ALARM, CLOCK_TRIGGER_SNOOZE, CLOCK_STATE_SNOOZE},
+    {CLOCK_STATE_SNOOZE, CLOCK_TRIGGER_SNOOZE_OVER, CLOCK_STATE_ALARM},
+    {CLOCK_STATE_SNOOZE, CLOCK_TRIGGER_ALARM_OFF, CLOCK_STATE_TIME},
+    {CLOCK_STATE_SET_ALARM, CLOCK_TRIGGER_ALARM_SET, CLOCK_STATE_TIME},
+    {CLOCK_STATE_SET_ALARM, CLOCK_TRIGGER_CANCEL, CLOCK_STATE_TIME},
+};
+constexpr uint8_t CLOCK_TRANSITIONS_NR = sizeof(clock_transitions) / sizeof(clock_transitions[0]);
+
+// Target of a trigger in a state, -1 if the table has no such transition
+constexpr int8_t clockTransitionTarget(clock_state_id_t from, clock_trigger_t trigger) {
+    for (uint8_t i = 0; i < CLOCK_TRANSITIONS_NR; i++) {
+        if (clock_transitions[i].from == from && clock_transitions[i].trigger == trigger)
+            return clock_transitions[i].to;
+    }
+    return -1;
+}
+
+// Every trigger leads to a single state, every state can be left and is reachable from the initial state
+constexpr bool clockTransitionsValid(void) {
+    bool reachable[CLOCK_STATES_NR] = {};
+    bool can_leave[CLOCK_STATES_NR] = {};
+    reachable[CLOCK_STATE_TIME] = true;
+    for (uint8_t i = 0; i < CLOCK_TRANSITIONS_NR; i++) {
+        const clock_transition_t *t = &clock_transitions[i];
+        if (t->from >= CLOCK_STATES_NR || t->to >= CLOCK_STATES_NR || t->from == t->to)
+            return false;
+        if (clockTransitionTarget(t->from, t->trigger) != t->to)
+            return false;  // Same trigger twice in a state
+        can_leave[t->from] = true;
+    }
+    // Each pass reaches at least one more state, otherwise the rest is unreachable
+    for (uint8_t pass = 0; pass < CLOCK_STATES_NR; pass++) {
+        for (uint8_t i = 0; i < CLOCK_TRANSITIONS_NR; i++) {
+            if (reachable[clock_transitions[i].from])
+                reachable[clock_transitions[i].to] = true;
+        }
+    }
+    for (uint8_t s = 0; s < CLOCK_STATES_NR; s++) {
+        if (!reachable[s] || !can_leave[s])
+            return false;
+    }
+    return true;
+}
+static_assert(clockTransitionsValid(), "The transition table has an ambiguous trigger, an unreachable state or a dead end");
+
+// Handlers of the events a state does not react to. Nothing is virtual: the clock machine calls the handlers of the
+// state it is in directly, so these empty ones compile away. enter and exit have no default, every state has to define
+// them, see clockStatesComplete
 class ClockState {
    public:
-    virtual void enter(ClockMachine* clock) = 0;
-    virtual void run(ClockMachine* clock) = 0;
-    virtual void timerExpired(ClockMachine* clock) = 0;
-    virtual void buttonShortPressed(ClockMachine* clock) = 0;
-    virtual void buttonLongPressed(ClockMachine* clock) = 0;
-    virtual void encoderRotated(ClockMachine* clock, rotary_encoder_pos_t position, rotary_encoder_dir_t direction = DIR_RIGHT) = 0;
-    virtual void exit(ClockMachine* clock) = 0;
-    virtual ~ClockState() {}
+    void run(ClockMachine* clock) {}
+    void timerExpired(ClockMachine* clock, clock_timer_id_t timer) {}
+    bool alarmDue(ClockMachine* clock) { return false; }  // Returns true if the alarm rings
+    void buttonShortPressed(ClockMachine* clock) {}
+    void buttonLongPressed(ClockMachine* clock) {}
+    void encoderRotated(ClockMachine* clock, rotary_encoder_pos_t position, rotary_encoder_dir_t direction) {}
 };
 
 class TimeState : public ClockState {
    public:
-    virtual void enter(ClockMachine* clock);
-    virtual void run(ClockMachine* clock);
-    virtual void timerExpired(ClockMachine* clock);
-    virtual void buttonShortPressed(ClockMachine* clock);
-    virtual void buttonLongPressed(ClockMachine* clock);
-    virtual void encoderRotated(ClockMachine* clock, rotary_encoder_pos_t position, rotary_encoder_dir_t direction = DIR_RIGHT);
-    virtual void exit(ClockMachine* clock);
-    static ClockState& getInstance();
-    virtual ~TimeState();
+    static constexpr clock_state_id_t id = CLOCK_STATE_TIME;
+    void enter(ClockMachine* clock);
+    void run(ClockMachine* clock);
+    void timerExpired(ClockMachine* clock, clock_timer_id_t timer);
+    bool alarmDue(ClockMachine* clock);
+    void buttonShortPressed(ClockMachine* clock);
+    void buttonLongPressed(ClockMachine* clock);
+    void encoderRotated(ClockMachine* clock, rotary_encoder_pos_t position, rotary_encoder_dir_t direction);
+    void exit(ClockMachine* clock);
 };
 
 class WPSState : public ClockState {
    public:
-    virtual void enter(ClockMachine* clock);
-    virtual void run(ClockMachine* clock);
-    virtual void timerExpired(ClockMachine* clock);
-    virtual void buttonShortPressed(ClockMachine* clock);
-    virtual void buttonLongPressed(ClockMachine* clock);
-    virtual void encoderRotated(ClockMachine* clock, rotary_encoder_pos_t position, rotary_encoder_dir_t direction = DIR_RIGHT);
-    virtual void exit(ClockMachine* clock);
-    static ClockState& getInstance();
-    virtual ~WPSState();
+    static constexpr clock_state_id_t id = CLOCK_STATE_WPS;
+    void enter(ClockMachine* clock);
+    void run(ClockMachine* clock);
+    void timerExpired(ClockMachine* clock, clock_timer_id_t timer);
+    void encoderRotated(ClockMachine* clock, rotary_encoder_pos_t position, rotary_encoder_dir_t direction);
+    void exit(ClockMachine* clock);
 
    private:
     bool blink;
@@ -53,15 +137,11 @@ class WPSState : public ClockState {
 
 class AlarmState : public ClockState {
    public:
-    virtual void enter(ClockMachine* clock);
-    virtual void run(ClockMachine* clock);
-    virtual void timerExpired(ClockMachine* clock);
-    virtual void buttonShortPressed(ClockMachine* clock);
-    virtual void buttonLongPressed(ClockMachine* clock);
-    virtual void encoderRotated(ClockMachine* clock, rotary_encoder_pos_t position, rotary_encoder_dir_t direction = DIR_RIGHT);
-    virtual void exit(ClockMachine* clock);
-    static ClockState& getInstance();
-    virtual ~AlarmState();
+    static constexpr clock_state_id_t id = CLOCK_STATE_ALARM;
+    void enter(ClockMachine* clock);
+    void timerExpired(ClockMachine* clock, clock_timer_id_t timer);
+    void buttonShortPressed(ClockMachine* clock);
+    void exit(ClockMachine* clock);
 
    private:
     uint8_t alarm_volume;
@@ -71,15 +151,13 @@ class AlarmState : public ClockState {
 
 class SnoozeState : public ClockState {
    public:
-    virtual void enter(ClockMachine* clock);
-    virtual void run(ClockMachine* clock);
-    virtual void timerExpired(ClockMachine* clock);
-    virtual void buttonShortPressed(ClockMachine* clock);
-    virtual void buttonLongPressed(ClockMachine* clock);
-    virtual void encoderRotated(ClockMachine* clock, rotary_encoder_pos_t position, rotary_encoder_dir_t direction = DIR_RIGHT);
-    virtual void exit(ClockMachine* clock);
-    static ClockState& getInstance();
-    virtual ~SnoozeState();
+    static constexpr clock_state_id_t id = CLOCK_STATE_SNOOZE;
+    void enter(ClockMachine* clock);
+    void timerExpired(ClockMachine* clock, clock_timer_id_t timer);
+    void buttonShortPressed(ClockMachine* clock);
+    void buttonLongPressed(ClockMachine* clock);
+    void encoderRotated(ClockMachine* clock, rotary_encoder_pos_t position, rotary_encoder_dir_t direction);
+    void exit(ClockMachine* clock);
 
    private:
     enum {
@@ -88,21 +166,18 @@ class SnoozeState : public ClockState {
         SNOOZE_LONG_PRESS,
     } snooze_leaving_step;
     rotary_encoder_dir_t first_rotation_dir;
-    int64_t snooze_start_timer_s;
     uint16_t remaining_snooze_time_s;
 };
 
 class SetAlarmState : public ClockState {
    public:
-    virtual void enter(ClockMachine* clock);
-    virtual void run(ClockMachine* clock);
-    virtual void timerExpired(ClockMachine* clock);
-    virtual void buttonShortPressed(ClockMachine* clock);
-    virtual void buttonLongPressed(ClockMachine* clock);
-    virtual void encoderRotated(ClockMachine* clock, rotary_encoder_pos_t position, rotary_encoder_dir_t direction = DIR_RIGHT);
-    virtual void exit(ClockMachine* clock);
-    static ClockState& getInstance();
-    virtual ~SetAlarmState();
+    static constexpr clock_state_id_t id = CLOCK_STATE_SET_ALARM;
+    void enter(ClockMachine* clock);
+    void timerExpired(ClockMachine* clock, clock_timer_id_t timer);
+    void buttonShortPressed(ClockMachine* clock);
+    void buttonLongPressed(ClockMachine* clock);
+    void encoderRotated(ClockMachine* clock, rotary_encoder_pos_t position, rotary_encoder_dir_t direction);
+    void exit(ClockMachine* clock);
 
    private:
     bool hours_hidden = false;
@@ -111,4 +186,28 @@ class SetAlarmState : public ClockState {
     clock_time_t original_alarm_time;
 };
 
-#endif // _INCLUDE_CLOCK_MACHINE_STATES_HPP_
\ No newline at end of file
+// All states, indexed by their id
+typedef std::tuple<TimeState, WPSState, AlarmState, SnoozeState, SetAlarmState> clock_states_t;
+
+template <typename State, typename = void>
+struct clock_state_has_enter : std::false_type {};
+template <typename State>
+struct clock_state_has_enter<State, std::void_t<decltype(&State::enter)>> : std::true_type {};
+template <typename State, typename = void>
+struct clock_state_has_exit : std::false_type {};
+template <typename State>
+struct clock_state_has_exit<State, std::void_t<decltype(&State::exit)>> : std::true_type {};
+
+static_assert(std::tuple_size<clock_states_t>::value == CLOCK_STATES_NR, "Every state has to be in clock_states_t");
+
+// Each state is at the position of its id and defines its enter and exit actions
+template <size_t... I>
+constexpr bool clockStatesComplete(std::index_sequence<I...>) {
+    return ((std::tuple_element<I, clock_states_t>::type::id == I) && ...) &&
+           (clock_state_has_enter<typename std::tuple_element<I, clock_states_t>::type>::value && ...) &&
+           (clock_state_has_exit<typename std::tuple_element<I, clock_states_t>::type>::value && ...);
+}
+static_assert(clockStatesComplete(std::make_index_sequence<CLOCK_STATES_NR>()),
+              "A state is out of order or has no enter or exit action");
+
+#endif // _INCLUDE_CLOCK_MACHINE_STATES_HPP_
@@ -0,0 +1,72 @@
+#include "clock_timers.hpp"
+
+// Names of the timers, as shown by esp_timer_dump
+static const char *clock_timer_names[CLOCK_TIMERS_NR] = {
+    "brightness",
+    "blink",
+    "cancel_window",
+    "snooze_tick",
+};
+
+void ClockTimers::timerCallback(void *arg) {
+    clock_timer_t *slot = (clock_timer_t *)arg;
+    clock_event_t event = {};
+    event.type = CLOCK_EVENT_TIMER;
+    event.timer.id = slot->id;
+    event.timer.generation = slot->generation;
+    // Never waits, that would delay all the other esp_timers. A periodic timer posts its next expiry anyway, an
+    // outdated one is filtered by its generation
+    if (xQueueSend(slot->timers->event_queue, &event, 0) != pdTRUE)
+        slot->timers->dropped_events++;
+}
+
+void ClockTimers::init(QueueHandle_t clock_event_queue) {
+    event_queue = clock_event_queue;
+    for (uint8_t i = 0; i < CLOCK_TIMERS_NR; i++) {
+        clock_timer_t *slot = &slots[i];
+        slot->timers = this;
+        slot->id = (clock_timer_id_t)i;
+        slot->generation = 0;
+        esp_timer_create_args_t timer_args = {
+            .callback = timerCallback,
+            .arg = slot,
+            .dispatch_method = ESP_TIMER_TASK,
+            .name = clock_timer_names[i],
+            .skip_unhandled_events = true,  // A periodic timer posts one expiry, not a burst, after a delay
+        };
+        ESP_ERROR_CHECK(esp_timer_create(&timer_args, &slot->handle));
+    }
+}
+
+void ClockTimers::invalidate(clock_timer_t *slot) {
+    // Stopped before the generation changes: an expiry posted before is outdated then, after the stop none is posted.
+    // Fails harmlessly if the timer is not running
+    esp_timer_stop(slot->handle);
+    slot->generation++;
+}
+
+void ClockTimers::startOnce(clock_timer_id_t id, uint32_t timeout_ms) {
+    clock_timer_t *slot = &slots[id];
+    invalidate(slot);
+    ESP_ERROR_CHECK(esp_timer_start_once(slot->handle, (uint64_t)timeout_ms * 1000));
+}
+
+void ClockTimers::startPeriodic(clock_timer_id_t id, uint32_t period_ms) {
+    clock_timer_t *slot = &slots[id];
+    invalidate(slot);
+    ESP_ERROR_CHECK(esp_timer_start_periodic(slot->handle, (uint64_t)period_ms * 1000));
+}
+
+void ClockTimers::stop(clock_timer_id_t id) {
+    invalidate(&slots[id]);
+}
+
+void ClockTimers::stopAll(void) {
+    for (uint8_t i = 0; i < CLOCK_TIMERS_NR; i++)
+        invalidate(&slots[i]);
+}
+
+bool ClockTimers::isCurrent(const clock_event_t *event) {
+    return (event->type == CLOCK_EVENT_TIMER) && (event->timer.id < CLOCK_TIMERS_NR) &&
+           (event->timer.generation == slots[event->timer.id].generation);
+}
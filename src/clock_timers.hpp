@@ -0,0 +1,39 @@
+#ifndef _INCLUDE_CLOCK_TIMERS_HPP_
+#define _INCLUDE_CLOCK_TIMERS_HPP_
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "esp_timer.h"
+#include "clock_events.hpp"
+
+class ClockTimers;
+
+typedef struct {
+    ClockTimers *timers;
+    clock_timer_id_t id;
+    esp_timer_handle_t handle;
+    uint32_t generation;  // Changes whenever the timer is started or stopped
+} clock_timer_t;
+
+// Named one-shot and periodic timers of the states. Every timer is an esp_timer of its own, created once, so starting
+// and stopping only look up its slot. Expiries are posted as CLOCK_EVENT_TIMER into the event queue, where
+// isCurrent() filters those of timers which have been stopped or restarted in the meantime
+class ClockTimers {
+    QueueHandle_t event_queue;
+    clock_timer_t slots[CLOCK_TIMERS_NR];
+    uint32_t dropped_events = 0;  // Only written by the esp_timer task
+
+    static void timerCallback(void *arg);
+    void invalidate(clock_timer_t *slot);
+
+   public:
+    void init(QueueHandle_t clock_event_queue);
+    void startOnce(clock_timer_id_t id, uint32_t timeout_ms);     // Restarts it if already running
+    void startPeriodic(clock_timer_id_t id, uint32_t period_ms);  // Restarts it if already running
+    void stop(clock_timer_id_t id);
+    void stopAll(void);
+    bool isCurrent(const clock_event_t *event);
+    uint32_t getDroppedEvents(void) { return dropped_events; }
+};
+
+#endif // _INCLUDE_CLOCK_TIMERS_HPP_
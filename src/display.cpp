@@ -2,47 +2,323 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/event_groups.h"
 #include "driver/ledc.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "soc/soc_caps.h"
+#include <string.h>
+#include <algorithm>
 #include <display.hpp>
-#include <Antonio_SemiBold75pt7b.h>
-#include <Antonio_Regular26pt7b.h>
-#include <Antonio_Light16pt7b.h>
+#include <display_layout.hpp>
+
+static const char *TAG = "display";
 
 void Display::monitorBrightnessTask(void *pvParameter) {
     Display *pThis = (Display *)pvParameter;
-    bool event;
+    uint32_t events;
     while (1) {
-        xQueueReceive(pThis->queue, &event, 1000 / portTICK_PERIOD_MS);
-        pThis->controlBrightness();
+        // The light is sampled every time the task wakes up: quickly while it changes, otherwise only on requests and
+        // with the minute update of the time, which wakes the CPU up anyway. Just while the backlight fades out it
+        // checks every second whether the panel may sleep already
+        TickType_t wait = DISPLAY_LIGHT_TRACK_PERIOD_MS / portTICK_PERIOD_MS;
+        if (pThis->light.getState()->settled) {
+            if (pThis->backlight_duty == 0 && !pThis->panel_sleep_requested)
+                wait = DISPLAY_LIGHT_FADE_PERIOD_MS / portTICK_PERIOD_MS;
+            else
+                wait = DISPLAY_LIGHT_SETTLED_PERIOD_MS / portTICK_PERIOD_MS;
+        }
+        events = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &events, wait);
+        pThis->brightness_wakeups++;
+        pThis->controlBrightness(events);
     }
 }
 
-void Display::init(void) {
-    lcd.init();
-    lcd.setRotation(0);
-    lcd.setColorDepth(16);
+void Display::sampleLight(void) {
+    // Oversampling: all reads of one wake-up form a block. A failed read only makes the block smaller
+    size_t samples_nr = 0;
+    for (uint8_t s = 0; s < DISPLAY_LIGHT_OVERSAMPLING; s++) {
+        int adc_raw;
+        if (adc_oneshot_read(adc1_handle, LIGHT_ADC_CHANNEL, &adc_raw) == ESP_OK)
+            light_samples[samples_nr++] = (uint16_t)adc_raw;
+    }
+    light.addBlock(light_samples, samples_nr, esp_timer_get_time());
+}
 
+void Display::initLightSensor(void) {
     // ADC1 config for light sensor
     adc_oneshot_unit_init_cfg_t init_config1 = {
         .unit_id = ADC_UNIT_1,
         .ulp_mode = ADC_ULP_MODE_DISABLE,
     };
-    ESP_ERROR_CHECK(adc_oneshot_new_unit(&init_config1, &adc1_handle));    
+    ESP_ERROR_CHECK(adc_oneshot_new_unit(&init_config1, &adc1_handle));
     adc_oneshot_chan_cfg_t config = {
         .atten = LIGHT_ADC_ATTEN,
         .bitwidth = ADC_BITWIDTH_12,
     };
     ESP_ERROR_CHECK(adc_oneshot_config_channel(adc1_handle, LIGHT_ADC_CHANNEL, &config));
+}
 
-    xTaskCreate(this->monitorBrightnessTask, "monitor_brightness_task", 2048, this, 1, NULL);
-    queue = xQueueCreate(1, sizeof(bool));
+void Display::init(void) {
+    lcd.init();
+    lcd.setRotation(0);
+    lcd.setColorDepth(16);
+    initBacklight();
+    initBackBuffers();
+    initDigitCache();
+    initLightSensor();
+
+    // All drawing happens in this task, updateContent only posts commands to it and never waits for the SPI bus.
+    // It has to exist before the brightness control starts, which may send the panel to sleep
+    xTaskCreate(this->renderTask, "display_render_task", DISPLAY_RENDER_TASK_STACK, this, 1, &render_task);
+    xTaskCreate(this->monitorBrightnessTask, "monitor_brightness_task", 2048, this, 1, &brightness_task);
+    // Nothing is known about the light yet, the brightness task starts sampling it right away
+    xTaskNotify(brightness_task, DISPLAY_LIGHT_EVENT_SAMPLE, eSetBits);
+}
+
+void Display::renderTask(void *pvParameter) {
+    Display *pThis = (Display *)pvParameter;
+    display_command_t command;
+    while (1) {
+        // While the time is rolling, the task wakes up for every frame of the animation as well
+        ulTaskNotifyTake(pdTRUE, pThis->getRollWait());
+        pThis->updatePanelPower();
+        if (!pThis->panel_sleeping) {
+            pThis->updatePalette();
+        }
+        if (pThis->roll_active && !pThis->panel_sleeping) {
+            pThis->rollTime();
+        }
+        if (!pThis->takeCommand(&command))
+            continue;
+
+        // Everything pending is drawn within a single bus transaction and flushed once at the end
+        int64_t start_us = esp_timer_get_time();
+        uint8_t commands_nr = 0;
+        pThis->lcd.startWrite();
+        do {
+            pThis->renderCommand(&command);
+            pThis->rememberCommand(&command);
+            commands_nr++;
+        } while (pThis->takeCommand(&command));
+        pThis->flush();
+        pThis->lcd.endWrite();
+        pThis->last_frame_time_us = esp_timer_get_time() - start_us;
+        ESP_LOGD(TAG, "Frame with %d commands took %lld us", commands_nr, (long long)pThis->last_frame_time_us);
+    }
 }
 
 void Display::updateContent(display_element_t element, void *value, display_action_t action) {
+    display_command_t command = {};
+    command.element = element;
+    command.action = action;
+    command.with_value = true;
+    if (value != NULL) {
+        command.value_valid = true;
+        if (element == D_E_SNOOZE_TIME) {
+            command.value.seconds = *(static_cast<uint16_t *>(value));
+        } else {
+            command.value.time = *(static_cast<clock_time_t *>(value));
+        }
+    }
+    postCommand(&command);
+}
+
+void Display::updateContent(display_element_t element, display_action_t action) {
+    display_command_t command = {};
+    command.element = element;
+    command.action = action;
+    postCommand(&command);
+}
+
+void Display::postCommand(const display_command_t *command) {
+    bool merged = false;
+    portENTER_CRITICAL(&render_mux);
+    // A command still waiting for the same element is replaced and its queue entry moves to the end, so that
+    // overlapping elements are still drawn in the order of their last update
+    for (uint8_t i = 0; i < render_queue_len; i++) {
+        if (render_queue[i] == command->element) {
+            for (uint8_t j = i; j < render_queue_len - 1; j++) {
+                render_queue[j] = render_queue[j + 1];
+            }
+            render_queue_len--;
+            merged = true;
+            break;
+        }
+    }
+    pending_commands[command->element] = *command;
+    render_queue[render_queue_len++] = command->element;
+    if (merged)
+        merged_commands++;
+    bool frame_open = (frame_depth > 0);
+    portEXIT_CRITICAL(&render_mux);
+
+    // Within a frame, the render task is woken up by endFrame()
+    if (!frame_open)
+        xTaskNotifyGive(render_task);
+}
+
+void Display::beginFrame(void) {
+    portENTER_CRITICAL(&render_mux);
+    frame_depth++;
+    portEXIT_CRITICAL(&render_mux);
+}
+
+void Display::endFrame(void) {
+    portENTER_CRITICAL(&render_mux);
+    if (frame_depth > 0)
+        frame_depth--;
+    bool frame_ready = (frame_depth == 0) && (render_queue_len > 0);
+    portEXIT_CRITICAL(&render_mux);
+
+    if (frame_ready)
+        xTaskNotifyGive(render_task);
+}
+
+void Display::setPanelSleep(bool sleep) {
+    portENTER_CRITICAL(&render_mux);
+    bool changed = (panel_sleep_requested != sleep);
+    panel_sleep_requested = sleep;
+    portEXIT_CRITICAL(&render_mux);
+
+    // The panel is only accessed from the render task, it will do the actual change
+    if (changed)
+        xTaskNotifyGive(render_task);
+}
+
+void Display::updatePanelPower(void) {
+    portENTER_CRITICAL(&render_mux);
+    bool sleep = panel_sleep_requested;
+    uint8_t pending = render_queue_len;
+    portEXIT_CRITICAL(&render_mux);
+
+    if (sleep == panel_sleeping)
+        return;
+
+    waitFlush();
+    if (sleep) {
+        // Sleep in: the panel stops scanning but keeps its frame memory, so no redraw is needed after wake up
+        lcd.sleep();
+        ESP_LOGI(TAG, "Panel asleep");
+    } else {
+        lcd.wakeup();
+        ESP_LOGI(TAG, "Panel awake, replaying %d pending commands", pending);
+    }
+    panel_sleeping = sleep;
+}
+
+void Display::setPalette(display_palette_t palette) {
+    portENTER_CRITICAL(&render_mux);
+    bool changed = (palette_requested != palette);
+    palette_requested = palette;
+    portEXIT_CRITICAL(&render_mux);
+
+    // The back buffers are only accessed from the render task, it will do the actual change
+    if (changed)
+        xTaskNotifyGive(render_task);
+}
+
+void Display::updatePalette(void) {
+    portENTER_CRITICAL(&render_mux);
+    display_palette_t palette = palette_requested;
+    portEXIT_CRITICAL(&render_mux);
+
+    if (palette == active_palette)
+        return;
+
+    // The 4 bpp back buffers keep their indices, they only get the new palette and are pushed again in one pass.
+    // Everything else is invalidated and drawn again by replaying the last command of each element
+    waitFlush();
+    active_palette = palette;
+    bool replay = false;
+    lcd.startWrite();
+    for (uint8_t r = 0; r < DISPLAY_REGIONS_NR; r++) {
+        display_region_t *region = &regions[r];
+        #if DISPLAY_BACK_BUFFER_BPP == 4
+        if (region->sprite != NULL) {
+            region->sprite->createPalette(display_palettes[palette], DISPLAY_PALETTE_COLORS_NR);
+            markDirty(region, region->x, region->y, region->w, region->h);
+            continue;
+        }
+        #endif
+        invalidateCells(region->x, region->y, region->w, region->h);
+        replay = true;
+    }
+    if (replay)
+        replayCommands();
+    flush();
+    lcd.endWrite();
+    ESP_LOGI(TAG, "%s palette active", (palette == D_P_NIGHT) ? "Night" : "Day");
+}
+
+void Display::renderCommand(const display_command_t *command) {
+    // renderContent takes the value as void *, the command itself stays untouched
+    display_command_t copy = *command;
+    command_shown = false;
+    void *value = copy.value_valid ? &copy.value : NULL;
+    if (copy.with_value) {
+        renderContent(copy.element, value, copy.action);
+    } else {
+        renderContent(copy.element, copy.action);
+    }
+}
+
+void Display::rememberCommand(const display_command_t *command) {
+    for (uint8_t i = 0; i < rendered_nr; i++) {
+        if (rendered_order[i] == command->element) {
+            for (uint8_t j = i; j < rendered_nr - 1; j++) {
+                rendered_order[j] = rendered_order[j + 1];
+            }
+            rendered_nr--;
+            break;
+        }
+    }
+    rendered_commands[command->element] = *command;
+    rendered_order[rendered_nr++] = command->element;
+    rendered_shown[command->element] = command_shown;
+}
+
+void Display::replayCommands(void) {
+    // In the original order, so that overlapping elements end up as before. The elements the regions still kept in a
+    // 4 bpp back buffer are valid and find nothing to draw. Commands which only cleared their element are skipped,
+    // the cleared area is black in every palette
+    for (uint8_t i = 0; i < rendered_nr; i++) {
+        display_element_t element = rendered_order[i];
+        if (!rendered_shown[element])
+            continue;
+        // The second bar is drawn next to the first one, which is still on the screen
+        if (element == D_E_SNOOZE_CANCEL && rendered_commands[element].action == D_A_TWO_BARS)
+            renderContent(D_E_SNOOZE_CANCEL, D_A_ONE_BAR);
+        renderCommand(&rendered_commands[element]);
+    }
+}
+
+int64_t Display::getLastFrameTime(void) {
+    return last_frame_time_us;
+}
+
+bool Display::takeCommand(display_command_t *command) {
+    bool available = false;
+    portENTER_CRITICAL(&render_mux);
+    // Nothing is taken while a frame is still being built, it is drawn as a whole once it is finished. And nothing
+    // is drawn on a sleeping panel
+    if (render_queue_len > 0 && frame_depth == 0 && !panel_sleeping) {
+        *command = pending_commands[render_queue[0]];
+        for (uint8_t j = 0; j < render_queue_len - 1; j++) {
+            render_queue[j] = render_queue[j + 1];
+        }
+        render_queue_len--;
+        available = true;
+    }
+    portEXIT_CRITICAL(&render_mux);
+    return available;
+}
+
+void Display::renderContent(display_element_t element, void *value, display_action_t action) {
     switch (element) {
         case D_E_TIME:
             char time_buf[8];
             sprintf(time_buf, "%02d:%02d", static_cast<clock_time_t *>(value)->hour, static_cast<clock_time_t *>(value)->minute);
-            lcd.setTextDatum(top_center);
 
             switch (action) {
                 case D_A_ON:
@@ -51,7 +327,21 @@ void Display::updateContent(display_element_t element, void *value, display_acti
                 default:
                     break;
             }
-            lcd.drawString(time_buf, (lcd.width() / 2) + 5, 10, &Antonio_SemiBold75pt7b);
+            int64_t redraw_start_us;
+            redraw_start_us = esp_timer_get_time();
+            digit_cache_hits = 0;
+            // A new time while the previous one is still rolling in is drawn on top of its final state
+            finishRoll();
+            if (analog_active != analog_requested)
+                switchFace();
+            if (analog_active) {
+                drawAnalogFace(static_cast<clock_time_t *>(value));
+            } else if (!startRoll(time_buf)) {
+                drawCells(D_E_TIME, 0, time_buf);
+            }
+            time_drawn = true;
+            ESP_LOGD(TAG, "Time redraw took %lld us, %d glyphs from cache", (long long)(esp_timer_get_time() - redraw_start_us),
+                     digit_cache_hits);
             break;
 
         case D_E_ALARM_TIME:
@@ -60,12 +350,10 @@ void Display::updateContent(display_element_t element, void *value, display_acti
             char alarm_symbol_buf[2];
             sprintf(alarm_symbol_buf, DISPLAY_SYMBOL_ALARM_ON);
             lcd.setTextColor(TFT_WHITE, TFT_BLACK);  // Normal case
-			lcd.setTextDatum(middle_center);
             switch (action) {
                 case D_A_OFF:
                     lcd.setTextColor(TFT_DARKGRAY, TFT_BLACK);
                     sprintf(alarm_symbol_buf, DISPLAY_SYMBOL_ALARM_OFF);
-                    sprintf(alarm_buf, "     ");
                     break;
                 case D_A_HIDE_HOURS:
                     alarm_buf[0] = alarm_buf[1] = ' ';
@@ -76,69 +364,60 @@ void Display::updateContent(display_element_t element, void *value, display_acti
                 default:
                     break;
             }
-            lcd.drawString(alarm_symbol_buf, 35, 205, &Antonio_Regular26pt7b);
-            lcd.drawString(alarm_buf, 100, 200, &Antonio_Regular26pt7b);
+            drawCells(D_E_ALARM_TIME, 0, alarm_symbol_buf);
+            if (action == D_A_OFF) {
+                clearCells(D_E_ALARM_TIME, 1);
+            } else {
+                drawCells(D_E_ALARM_TIME, 1, alarm_buf);
+            }
             break;
 
         case D_E_BED_TIME:
             char bed_time_buf[8];
             sprintf(bed_time_buf, "%01d:%02d", static_cast<clock_time_t *>(value)->hour, static_cast<clock_time_t *>(value)->minute);
-            char bed_time_symbol_buf[3];
-            sprintf(bed_time_symbol_buf, DISPLAY_SYMBOL_BED);
             lcd.setTextColor(TFT_LIGHTGRAY, TFT_BLACK);  // Normal case
-			lcd.setTextDatum(middle_center);
             // We show the remaining bed time only when less than 9 hours
             if (static_cast<clock_time_t *>(value)->hour >= 9)
                 action = D_A_OFF;
 
             switch (action) {
                 case D_A_OFF:
-                    sprintf(bed_time_buf, "    ");
-                    sprintf(bed_time_symbol_buf, "  ");
+                    clearCells(D_E_BED_TIME, 0);
+                    clearCells(D_E_BED_TIME, 1);
                     break;
                 default:
+                    drawCells(D_E_BED_TIME, 0, DISPLAY_SYMBOL_BED);
+                    drawCells(D_E_BED_TIME, 1, bed_time_buf);
                     break;
             }
-            lcd.drawString(bed_time_symbol_buf, 180, 205, &Antonio_Regular26pt7b);
-            lcd.drawString(bed_time_buf, 235, 200, &Antonio_Regular26pt7b);
             break;
 
         case D_E_SNOOZE_TIME:
-            char snooze_buf[8];
-            lcd.setTextDatum(middle_center);
             lcd.setTextColor(TFT_ORANGE, TFT_BLACK);
             switch (action) {
                 case D_A_OFF:
-                    sprintf(snooze_buf, "     ");
-                    lcd.drawString("  ", 175, 205, &Antonio_Regular26pt7b);
+                    clearCells(D_E_SNOOZE_TIME, 0);
+                    clearCells(D_E_SNOOZE_TIME, 1);
                     break;
                 case D_A_ON:
-                    uint8_t minutes;
-                    uint8_t seconds;
-                    uint16_t remaining_seconds;
-                    remaining_seconds = *(static_cast<uint16_t *>(value));
-                    minutes = remaining_seconds / 60;
-                    seconds = remaining_seconds % 60;
-                    sprintf(snooze_buf, "%01d:%02d", minutes, seconds);
-                    lcd.drawString(DISPLAY_SYMBOL_SNOOZE, 175, 205, &Antonio_Regular26pt7b);
+                    drawCountdown(*(static_cast<uint16_t *>(value)));
                     break;
                 default:
                     break;
             }
-            lcd.drawString(snooze_buf, 230, 200, &Antonio_Regular26pt7b);
             break;
 
         default:
             break;
     }
+    reportSavedBytes(element);
 }
 
-void Display::updateContent(display_element_t element, display_action_t action) {
+void Display::renderContent(display_element_t element, display_action_t action) {
     switch (element) {
         case D_E_ALARM_ACTIVE:
             char alarm_active_symbol_buf[2];
             lcd.setTextColor(TFT_WHITE, TFT_BLACK);  // Normal case
-            lcd.setTextDatum(middle_center);
             switch (action) {
                 case D_A_OFF:
                     sprintf(alarm_active_symbol_buf, DISPLAY_SYMBOL_ALARM_L);
@@ -149,25 +428,23 @@ void Display::updateContent(display_element_t element, display_action_t action)
                 default:
                     break;
             }
-            lcd.drawString(alarm_active_symbol_buf, 35, 205, &Antonio_Regular26pt7b);
+            drawCells(D_E_ALARM_ACTIVE, 0, alarm_active_symbol_buf);
             break;
 
         case D_E_SNOOZE_CANCEL:
             switch (action) {
                 case D_A_OFF:
                     // Clear all the bars
-                    lcd.setColor(TFT_BLACK);
-                    lcd.fillRect(160, 160, 75, 5);
+                    fillArea(DISPLAY_LAYOUT_BAR_1_X, DISPLAY_LAYOUT_BAR_Y, DISPLAY_LAYOUT_BAR_2_X + DISPLAY_LAYOUT_BAR_W - DISPLAY_LAYOUT_BAR_1_X,
+                             DISPLAY_LAYOUT_BAR_H, TFT_BLACK);
                     break;
                 case D_A_ONE_BAR:
                     // Draw only the first bar
-                    lcd.setColor(TFT_ORANGE);
-                    lcd.fillRect(160, 160, 35, 5);
+                    fillArea(DISPLAY_LAYOUT_BAR_1_X, DISPLAY_LAYOUT_BAR_Y, DISPLAY_LAYOUT_BAR_W, DISPLAY_LAYOUT_BAR_H, TFT_ORANGE);
                     break;
                 case D_A_TWO_BARS:
                     // Draw only the second bar
-                    lcd.setColor(TFT_ORANGE);
-                    lcd.fillRect(200, 160, 35, 5);
+                    fillArea(DISPLAY_LAYOUT_BAR_2_X, DISPLAY_LAYOUT_BAR_Y, DISPLAY_LAYOUT_BAR_W, DISPLAY_LAYOUT_BAR_H, TFT_ORANGE);
                     break;
                 default:
                     // There is no "case 3" where all 3 bars are shown
@@ -176,23 +453,14 @@ void Display::updateContent(display_element_t element, display_action_t action)
             break;
 
         case D_E_WIFI_STATUS:
-            lcd.setTextDatum(middle_center);
             switch (action) {
                 case D_A_OFF:
                     lcd.setTextColor(TFT_RED, TFT_BLACK);
-                    #ifdef MQTT_ACTIVE
-                    lcd.drawString(DISPLAY_SYMBOL_WIFI_OFF, 295, 170, &Antonio_Regular26pt7b);
-                    #else
-                    lcd.drawString(DISPLAY_SYMBOL_WIFI_OFF, 295, 205, &Antonio_Regular26pt7b);
-                    #endif
+                    drawCells(D_E_WIFI_STATUS, 0, DISPLAY_SYMBOL_WIFI_OFF);
                     break;
                 case D_A_ON:
                     lcd.setTextColor(TFT_WHITE, TFT_BLACK);
-                    #ifdef MQTT_ACTIVE
-                    lcd.drawString(DISPLAY_SYMBOL_WIFI_ON, 295, 170, &Antonio_Regular26pt7b);
-                    #else
-                    lcd.drawString(DISPLAY_SYMBOL_WIFI_ON, 295, 205, &Antonio_Regular26pt7b);
-                    #endif
+                    drawCells(D_E_WIFI_STATUS, 0, DISPLAY_SYMBOL_WIFI_ON);
                     break;
                 default:
                     break;
@@ -201,15 +469,14 @@ void Display::updateContent(display_element_t element, display_action_t action)
 
         #ifdef MQTT_ACTIVE
         case D_E_MQTT_STATUS:
-            lcd.setTextDatum(middle_center);
             switch (action) {
                 case D_A_OFF:
                     lcd.setTextColor(TFT_RED, TFT_BLACK);
-                    lcd.drawString(DISPLAY_SYMBOL_MQTT_OFF, 295, 205, &Antonio_Regular26pt7b);
+                    drawCells(D_E_MQTT_STATUS, 0, DISPLAY_SYMBOL_MQTT_OFF);
                     break;
                 case D_A_ON:
                     lcd.setTextColor(TFT_WHITE, TFT_BLACK);
-                    lcd.drawString(DISPLAY_SYMBOL_MQTT_ON, 295, 205, &Antonio_Regular26pt7b);
+                    drawCells(D_E_MQTT_STATUS, 0, DISPLAY_SYMBOL_MQTT_ON);
                     break;
                 default:
                     break;
@@ -218,31 +485,29 @@ void Display::updateContent(display_element_t element, display_action_t action)
         #endif
 
         case D_E_WIFI_SETTING:
-            lcd.setTextDatum(middle_center);
             lcd.setTextColor(TFT_YELLOW, TFT_BLACK);
             switch (action) {
                 case D_A_ON:
-                    lcd.drawString(DISPLAY_SYMBOL_WIFI_COG, 295, 170, &Antonio_Regular26pt7b);
-                    lcd.drawString("PRESS", 220, 175, &Antonio_Light16pt7b);
-                    lcd.drawString("WPS", 220, 210, &Antonio_Light16pt7b);
+                    drawCells(D_E_WIFI_SETTING, 0, DISPLAY_SYMBOL_WIFI_COG);
+                    drawCells(D_E_WIFI_SETTING, 1, "PRESS");
+                    drawCells(D_E_WIFI_SETTING, 2, "WPS");
                     break;
                 default:
-                    lcd.drawString("  ", 295, 170, &Antonio_Regular26pt7b);
-                    lcd.setColor(TFT_BLACK);
-                    lcd.fillRect(180, 150, 90, 80);
+                    clearCells(D_E_WIFI_SETTING, 0);
+                    clearCells(D_E_WIFI_SETTING, 1);
+                    clearCells(D_E_WIFI_SETTING, 2);
                     break;
             }
             break;
 
         case D_E_AUDIO:
-            lcd.setTextDatum(middle_center);
             lcd.setTextColor(TFT_RED, TFT_BLACK);
             switch (action) {
                 case D_A_OFF:
-                    lcd.drawString(DISPLAY_SYMBOL_AUDIO_OFF, 35, 170, &Antonio_Regular26pt7b);
+                    drawCells(D_E_AUDIO, 0, DISPLAY_SYMBOL_AUDIO_OFF);
                     break;
                 default:
-                    lcd.drawString("  ", 35, 170, &Antonio_Regular26pt7b);
+                    clearCells(D_E_AUDIO, 0);
                     break;
             }
             break;
@@ -250,65 +515,1144 @@ void Display::updateContent(display_element_t element, display_action_t action)
         default:
             break;
     }
+    reportSavedBytes(element);
 }
 
-void Display::controlBrightness(void) {
-    int adc_raw;
-    uint16_t ambient_light = 0;
+bool Display::startRoll(const char *text) {
+    const RLEfont *font = display_layout[D_E_TIME][0].font;
+    display_cells_t *cache = &cells[D_E_TIME][0];
+    size_t length = strlen(text);
+    if (!roll_enabled || !cache->valid || (cache->color != lcd.getTextStyle().fore_rgb888) ||
+        (strlen(cache->text) != length) || (length >= DISPLAY_CELLS_MAX) || (rleTextWidth(font, text) != cache->w))
+        return false;
+    // The frames are composed in the back buffer, drawing them on the panel directly would flicker
+    display_region_t *region = findRegion(cache->x, cache->y);
+    if (region == NULL || region->sprite == NULL)
+        return false;
+
+    // The last digits roll, as many as fit into the budget of a frame. The others change right away
+    char first_frame[DISPLAY_CELLS_MAX];
+    strcpy(first_frame, text);
+    int32_t budget = DISPLAY_ROLL_FRAME_BUDGET_PX;
+    int32_t cell_x = cache->x + cache->w;
+    bool rolling = false;
+    memset(roll_from, 0, sizeof(roll_from));
+    for (int8_t i = length - 1; i >= 0; i--) {
+        int32_t cell_w = rleCharWidth(font, text[i]);
+        cell_x -= cell_w;
+        if ((cache->text[i] == text[i]) || (rleCharWidth(font, cache->text[i]) != cell_w) || (cell_w * cache->h > budget))
+            continue;
+        budget -= cell_w * cache->h;
+        roll_from[i] = cache->text[i];
+        roll_to[i] = text[i];
+        roll_x[i] = cell_x;
+        first_frame[i] = cache->text[i];
+        rolling = true;
+    }
+    if (!rolling)
+        return false;
+    drawCells(D_E_TIME, 0, first_frame);
 
-    ESP_ERROR_CHECK(adc_oneshot_read(adc1_handle, LIGHT_ADC_CHANNEL, &adc_raw));
-    ambient_light = (uint16_t)adc_raw;
+    // From now on the cache describes the time as it is at the end of the animation
+    strcpy(cache->text, text);
+    roll_style = lcd.getTextStyle();
+    roll_frame = 0;
+    roll_start_us = esp_timer_get_time();
+    roll_active = true;
+    return true;
+}
 
-    if (ambient_light == 0) {
-        // We could not read the ambient light, we try again in the next iteration
+void Display::rollTime(void) {
+    // Every frame is due at a fixed time. If the task is late, e.g. because the previous frame took too long, the
+    // frames in between are dropped
+    int64_t elapsed_us = esp_timer_get_time() - roll_start_us;
+    int64_t frame = std::min(elapsed_us / (DISPLAY_ROLL_FRAME_PERIOD_MS * 1000), (int64_t)DISPLAY_ROLL_FRAMES_NR);
+    if (frame <= roll_frame)
         return;
+    dropped_frames += frame - roll_frame - 1;
+    lcd.startWrite();
+    drawRollFrame(frame);
+    flush();
+    lcd.endWrite();
+    if (frame == DISPLAY_ROLL_FRAMES_NR) {
+        roll_active = false;
+        ESP_LOGD(TAG, "Time rolled in %lld us, %lu frames dropped so far", (long long)elapsed_us,
+                 (unsigned long)dropped_frames);
     }
+}
 
-    if (max_brightness_requested) {
-        setBrightness(DISPLAY_BRIGHTNESS_LEVELS_NR);
+void Display::finishRoll(void) {
+    if (!roll_active)
+        return;
+    // Frames which have not been shown any more count as dropped
+    dropped_frames += DISPLAY_ROLL_FRAMES_NR - roll_frame - 1;
+    drawRollFrame(DISPLAY_ROLL_FRAMES_NR);
+    roll_active = false;
+}
+
+void Display::drawRollFrame(uint8_t frame) {
+    display_cells_t *cache = &cells[D_E_TIME][0];
+    const RLEfont *font = display_layout[D_E_TIME][0].font;
+    display_region_t *region = findRegion(cache->x, cache->y);
+    lgfx::LGFX_Sprite *canvas = region->sprite;
+    int32_t offset = cache->h * frame / DISPLAY_ROLL_FRAMES_NR;
+    int32_t y = cache->y - region->y;
+
+    // Both glyphs are drawn with their whole cell, so together they cover the cell completely
+    waitFlush();
+    lgfx::TextStyle style = lcd.getTextStyle();
+    lcd.setTextStyle(roll_style);
+    for (uint8_t i = 0; i < DISPLAY_CELLS_MAX; i++) {
+        if (roll_from[i] == '\0')
+            continue;
+        int32_t cell_w = rleCharWidth(font, roll_to[i]);
+        int32_t x = roll_x[i] - region->x;
+        const display_area_t clip = {x, y, x + cell_w, y + cache->h};
+        canvas->setClipRect(x, y, cell_w, cache->h);
+        if (offset < cache->h) {
+            drawGlyph(canvas, roll_from[i], x, y - offset, font, &clip);
+        }
+        drawGlyph(canvas, roll_to[i], x, y + cache->h - offset, font, &clip);
+        canvas->clearClipRect();
+        markDirty(region, roll_x[i], cache->y, cell_w, cache->h);
+    }
+    lcd.setTextStyle(style);
+    roll_frame = frame;
+}
+
+TickType_t Display::getRollWait(void) {
+    if (!roll_active || panel_sleeping)
+        return portMAX_DELAY;
+    int64_t next_frame_us = roll_start_us + (int64_t)(roll_frame + 1) * DISPLAY_ROLL_FRAME_PERIOD_MS * 1000;
+    // Rounded up, waking up too early would only spin until the frame is due
+    int64_t wait_us = std::max(next_frame_us - esp_timer_get_time(), (int64_t)0);
+    return (wait_us + portTICK_PERIOD_MS * 1000 - 1) / (portTICK_PERIOD_MS * 1000);
+}
+
+void Display::drawCells(display_element_t element, uint8_t index, const char *text) {
+    const display_slot_t *slot = &display_layout[element][index];
+    const RLEfont *font = slot->font;
+    display_cells_t *cache = &cells[element][index];
+    uint32_t color = lcd.getTextStyle().fore_rgb888;
+    uint8_t datum = slot->datum;
+    int32_t x = slot->x;
+    int32_t y = slot->y;
+    size_t length = strlen(text);
+    int32_t w = rleTextWidth(font, text);
+    int32_t h = font->height;
+
+    // Resolve the datum to the top left corner the same way drawString does, so that single cells are placed
+    // exactly where the complete string would have been drawn
+    if (datum & top_center) {
+        x -= w >> 1;
+    } else if (datum & top_right) {
+        x -= w;
+    }
+    if (datum & middle_left) {
+        y -= h >> 1;
+    } else if (datum & bottom_left) {
+        y -= h;
+    }
+
+    // A cell by cell update is only possible if the string keeps its geometry and colour. Otherwise (or if another
+    // element has painted over it in the meantime) the whole string is redrawn
+    bool full_redraw = !cache->valid || (cache->color != color) || (cache->x != x) || (cache->y != y) ||
+                       (cache->w != w) || (strlen(cache->text) != length) || (length >= DISPLAY_CELLS_MAX);
+
+    // Other strings in the same place, e.g. the alarm symbols, will have to be redrawn completely. Only what is
+    // actually drawn is invalidated, the cache of this string keeps the old text for comparison anyway
+    int32_t area_x = x - slot->overhang_left;
+    int32_t area_w = w + slot->overhang_left + slot->overhang_right;
+    if (full_redraw) {
+        invalidateCells(area_x, y, area_w, h);
+    }
+
+    // Draw into the back buffer of the region if there is one, otherwise directly on the panel
+    waitFlush();
+    display_region_t *region = findRegion(x, y);
+    lgfx::LovyanGFX *canvas = &lcd;
+    int32_t offset_x = 0;
+    int32_t offset_y = 0;
+    if (region != NULL && region->sprite != NULL) {
+        canvas = region->sprite;
+        offset_x = region->x;
+        offset_y = region->y;
+    }
+
+    // Without a background the pixels of the old glyph could not be removed one by one
+    const lgfx::TextStyle &style = lcd.getTextStyle();
+    bool diff_possible = !full_redraw && (style.back_rgb888 != style.fore_rgb888);
+
+    // Glyphs of the previous string may have reached beyond the cells, those remains are removed here
+    if (full_redraw && (style.back_rgb888 != style.fore_rgb888)) {
+        canvas->setColor(canvasColor(canvas, style.back_rgb888));
+        if (slot->overhang_left > 0) {
+            canvas->fillRect(area_x - offset_x, y - offset_y, slot->overhang_left, h);
+            markDirty(region, area_x, y, slot->overhang_left, h);
+        }
+        if (slot->overhang_right > 0) {
+            canvas->fillRect(x + w - offset_x, y - offset_y, slot->overhang_right, h);
+            markDirty(region, x + w, y, slot->overhang_right, h);
+        }
+    }
+
+    int32_t cell_x = x;
+    uint32_t pixels = 0;
+    for (size_t i = 0; i < length; i++) {
+        int32_t cell_w = rleCharWidth(font, text[i]);
+        if (!full_redraw && (cache->text[i] == text[i])) {
+            cell_x += cell_w;
+            continue;
+        }
+        // Usually most pixels of the old and the new glyph are the same, e.g. from 8 to 9, so only the differences
+        // are drawn
+        int32_t diff_pixels = -1;
+        display_area_t changed;
+        if (diff_possible && rleCharWidth(font, cache->text[i]) == cell_w) {
+            diff_pixels = drawGlyphDiff(canvas, cache->text[i], text[i], cell_x - offset_x, y - offset_y, font, &changed);
+        }
+        if (diff_pixels >= 0) {
+            if (diff_pixels > 0) {
+                // Back to screen coordinates
+                int32_t changed_x = changed.x0 + offset_x;
+                int32_t changed_y = changed.y0 + offset_y;
+                invalidateCells(changed_x, changed_y, changed.x1 - changed.x0, changed.y1 - changed.y0);
+                markDirty(region, changed_x, changed_y, changed.x1 - changed.x0, changed.y1 - changed.y0);
+            }
+            pixels += diff_pixels;
+        } else {
+            drawGlyph(canvas, text[i], cell_x - offset_x, y - offset_y, font, NULL);
+            // Glyphs may reach beyond their cell, e.g. symbols with a negative x offset
+            const RLEglyph *glyph = rleGetGlyph(font, text[i]);
+            int32_t dirty_x0 = cell_x;
+            int32_t dirty_x1 = cell_x + cell_w;
+            if (glyph != NULL && glyph->width > 0) {
+                dirty_x0 = std::min(dirty_x0, cell_x + glyph->xOffset);
+                dirty_x1 = std::max(dirty_x1, cell_x + glyph->xOffset + glyph->width);
+            }
+            invalidateCells(dirty_x0, y, dirty_x1 - dirty_x0, h);
+            markDirty(region, dirty_x0, y, dirty_x1 - dirty_x0, h);
+            pixels += cell_w * h;
+        }
+        cell_x += cell_w;
+    }
+
+    command_shown = true;
+    // Every pixel is sent as RGB565, that is 2 bytes
+    drawn_pixels += pixels;
+    saved_bytes += (w * h - std::min(pixels, (uint32_t)(w * h))) * 2;
+
+    if (length < DISPLAY_CELLS_MAX) {
+        strcpy(cache->text, text);
+        cache->color = color;
+        cache->x = x;
+        cache->y = y;
+        cache->w = w;
+        cache->h = h;
+        cache->valid = true;
+    }
+}
+
+void Display::drawCountdown(uint16_t seconds) {
+    // Updated every second while snoozing. Only the cells which differ from the last rendered digits are drawn:
+    // the seconds every time, the minutes on rollover. The symbol is static, it is only drawn when the countdown
+    // appears or after something has painted over it
+    char text[DISPLAY_CELLS_MAX];
+    uint8_t length = 0;
+    uint16_t minutes = seconds / 60;
+    if (minutes >= 10)
+        text[length++] = '0' + (minutes / 10) % 10;
+    text[length++] = '0' + minutes % 10;
+    text[length++] = ':';
+    text[length++] = '0' + (seconds % 60) / 10;
+    text[length++] = '0' + seconds % 10;
+    text[length] = '\0';
+
+    if (!cells[D_E_SNOOZE_TIME][0].valid)
+        drawCells(D_E_SNOOZE_TIME, 0, DISPLAY_SYMBOL_SNOOZE);
+    drawCells(D_E_SNOOZE_TIME, 1, text);
+}
+
+void Display::switchFace(void) {
+    // The face shown so far is removed completely, this also invalidates the cells of the digits and the dial
+    if (!time_drawn) {
+        // Nothing to remove yet
+    } else if (analog_active) {
+        fillArea(DISPLAY_LAYOUT_DIAL_X - DISPLAY_LAYOUT_DIAL_R, DISPLAY_LAYOUT_DIAL_Y - DISPLAY_LAYOUT_DIAL_R,
+                 2 * DISPLAY_LAYOUT_DIAL_R + 1, 2 * DISPLAY_LAYOUT_DIAL_R + 1, TFT_BLACK);
+    } else {
+        clearCells(D_E_TIME, 0);
+    }
+    analog_active = analog_requested;
+    face_valid = false;
+}
+
+static bool areasOverlap(const display_area_t *a, const display_area_t *b) {
+    return (a->x0 < b->x1) && (b->x0 < a->x1) && (a->y0 < b->y1) && (b->y0 < a->y1);
+}
+
+void Display::drawAnalogFace(const clock_time_t *time) {
+    // The hour hand moves in steps of 12 minutes, like the minute hand between the ticks
+    uint8_t positions[DISPLAY_HANDS_NR] = {(uint8_t)((time->hour % 12) * 5 + time->minute / 12), time->minute};
+    const display_dial_shape_t *hands[DISPLAY_HANDS_NR] = {&display_dial_hour_hand, &display_dial_minute_hand};
+    const display_area_t dial = {DISPLAY_LAYOUT_DIAL_X - DISPLAY_LAYOUT_DIAL_R, DISPLAY_LAYOUT_DIAL_Y - DISPLAY_LAYOUT_DIAL_R,
+                                 DISPLAY_LAYOUT_DIAL_X + DISPLAY_LAYOUT_DIAL_R + 1, DISPLAY_LAYOUT_DIAL_Y + DISPLAY_LAYOUT_DIAL_R + 1};
+    uint32_t color = lcd.getTextStyle().fore_rgb888;
+    command_shown = true;
+
+    waitFlush();
+    display_region_t *region = findRegion(dial.x0, dial.y0);
+    lgfx::LovyanGFX *canvas = &lcd;
+    int32_t offset_x = 0;
+    int32_t offset_y = 0;
+    if (region != NULL && region->sprite != NULL) {
+        canvas = region->sprite;
+        offset_x = region->x;
+        offset_y = region->y;
+    }
+
+    // Only the pixels of the hands which moved are erased. Everything else within their bounds, at the old and the
+    // new position, is drawn again on top in the usual order: ticks, hour hand, minute hand, cap
+    display_area_t damage = {INT32_MAX, INT32_MAX, INT32_MIN, INT32_MIN};
+    uint32_t pixels = 0;
+    if (!face_valid || hand_color != color) {
+        canvas->setColor(canvasColor(canvas, 0));
+        canvas->fillRect(dial.x0 - offset_x, dial.y0 - offset_y, dial.x1 - dial.x0, dial.y1 - dial.y0);
+        damage = dial;
+        pixels += (dial.x1 - dial.x0) * (dial.y1 - dial.y0);
     } else {
-        // Adjust the brightness level if necessary
-        if ((display_brightness_level > 0) &&
-            (ambient_light < display_light_thd_down[display_brightness_level - 1])) {
-            display_brightness_level--;
-        } else if ((display_brightness_level < DISPLAY_BRIGHTNESS_LEVELS_NR) &&
-                   (ambient_light > display_light_thd_up[display_brightness_level])) {
-            display_brightness_level++;
-        }
-        if (increased_brightness_requested) {
-            setBrightness(display_brightness_level + 1);
+        canvas->setColor(canvasColor(canvas, 0));
+        for (uint8_t h = 0; h < DISPLAY_HANDS_NR; h++) {
+            if (positions[h] == hand_positions[h])
+                continue;
+            display_area_t old_bounds, new_bounds;
+            getDialShapeBounds(hands[h], hand_positions[h], &old_bounds);
+            getDialShapeBounds(hands[h], positions[h], &new_bounds);
+            pixels += fillDialShape(canvas, hands[h], hand_positions[h], &old_bounds, offset_x, offset_y);
+            damage = {std::min({damage.x0, old_bounds.x0, new_bounds.x0}), std::min({damage.y0, old_bounds.y0, new_bounds.y0}),
+                      std::max({damage.x1, old_bounds.x1, new_bounds.x1}), std::max({damage.y1, old_bounds.y1, new_bounds.y1})};
+        }
+        if (damage.x1 <= damage.x0)
+            return;
+    }
+
+    for (uint8_t t = 0; t < DISPLAY_LAYOUT_DIAL_TICKS; t++) {
+        bool quarter = (t % 3 == 0);
+        const display_dial_shape_t *tick = quarter ? &display_dial_quarter_tick : &display_dial_tick;
+        uint8_t position = t * 60 / DISPLAY_LAYOUT_DIAL_TICKS;
+        display_area_t bounds;
+        getDialShapeBounds(tick, position, &bounds);
+        if (!areasOverlap(&bounds, &damage))
+            continue;
+        canvas->setColor(canvasColor(canvas, lcd.color16to24(quarter ? TFT_LIGHTGRAY : TFT_DARKGRAY)));
+        pixels += fillDialShape(canvas, tick, position, &damage, offset_x, offset_y);
+    }
+    canvas->setColor(canvasColor(canvas, color));
+    for (uint8_t h = 0; h < DISPLAY_HANDS_NR; h++) {
+        pixels += fillDialShape(canvas, hands[h], positions[h], &damage, offset_x, offset_y);
+    }
+    canvas->setColor(canvasColor(canvas, lcd.color16to24(TFT_ORANGE)));
+    pixels += fillDialCap(canvas, &damage, offset_x, offset_y);
+    markDirty(region, damage.x0, damage.y0, damage.x1 - damage.x0, damage.y1 - damage.y0);
+
+    // Compared with drawing the whole dial
+    uint32_t dial_pixels = (dial.x1 - dial.x0) * (dial.y1 - dial.y0);
+    uint32_t damage_pixels = (damage.x1 - damage.x0) * (damage.y1 - damage.y0);
+    drawn_pixels += pixels;
+    saved_bytes += (dial_pixels - std::min(damage_pixels, dial_pixels)) * 2;
+
+    memcpy(hand_positions, positions, sizeof(hand_positions));
+    hand_color = color;
+    face_valid = true;
+}
+
+// Corners of a shape of the dial in 1/16 pixels: inner left, inner right, outer right, outer left
+static void getDialShapeVertices(const display_dial_shape_t *shape, uint8_t position, int32_t x[4], int32_t y[4]) {
+    // The direction of the position is (sin, -cos) on the screen, its right side (cos, sin). Both in 1/16384
+    int32_t s = displayDialSin(position);
+    int32_t c = displayDialCos(position);
+    const int32_t radius[4] = {shape->inner * 16, shape->inner * 16, shape->outer * 16, shape->outer * 16};
+    const int32_t side[4] = {-shape->inner_width, shape->inner_width, shape->outer_width, -shape->outer_width};
+    for (uint8_t i = 0; i < 4; i++) {
+        x[i] = DISPLAY_LAYOUT_DIAL_X * 16 + 8 + (radius[i] * s + side[i] * c) / 16384;
+        y[i] = DISPLAY_LAYOUT_DIAL_Y * 16 + 8 + (side[i] * s - radius[i] * c) / 16384;
+    }
+}
+
+void Display::getDialShapeBounds(const display_dial_shape_t *shape, uint8_t position, display_area_t *bounds) {
+    int32_t x[4], y[4];
+    getDialShapeVertices(shape, position, x, y);
+    *bounds = {*std::min_element(x, x + 4) / 16, *std::min_element(y, y + 4) / 16,
+               *std::max_element(x, x + 4) / 16 + 1, *std::max_element(y, y + 4) / 16 + 1};
+}
+
+// Fills the pixels whose centers lie within the shape, as far as they are within clip. Returns the number of pixels
+uint32_t Display::fillDialShape(lgfx::LovyanGFX *canvas, const display_dial_shape_t *shape, uint8_t position,
+                                const display_area_t *clip, int32_t offset_x, int32_t offset_y) {
+    int32_t x[4], y[4];
+    getDialShapeVertices(shape, position, x, y);
+    int32_t top = std::max((*std::min_element(y, y + 4) + 7) / 16, clip->y0);
+    int32_t bottom = std::min((*std::max_element(y, y + 4) - 8) / 16, clip->y1 - 1);
+    uint32_t pixels = 0;
+    for (int32_t row = top; row <= bottom; row++) {
+        // The shape is convex, every row is a single span between two edges
+        int32_t center = row * 16 + 8;
+        int32_t left = INT32_MAX;
+        int32_t right = INT32_MIN;
+        for (uint8_t i = 0; i < 4; i++) {
+            uint8_t j = (i + 1) % 4;
+            if ((center < y[i] && center < y[j]) || (center > y[i] && center > y[j]))
+                continue;
+            int32_t edge_x0 = x[i];
+            int32_t edge_x1 = x[j];
+            if (y[i] != y[j]) {
+                edge_x0 = edge_x1 = x[i] + (x[j] - x[i]) * (center - y[i]) / (y[j] - y[i]);
+            }
+            left = std::min({left, edge_x0, edge_x1});
+            right = std::max({right, edge_x0, edge_x1});
+        }
+        if (left > right)
+            continue;
+        int32_t first = (left + 7) / 16;
+        int32_t last = (right - 8) / 16;
+        if (first > last) {
+            // Thinner than a pixel here, the hand must not break up
+            first = last = ((left + right) / 2) / 16;
+        }
+        first = std::max(first, clip->x0);
+        last = std::min(last, clip->x1 - 1);
+        if (first > last)
+            continue;
+        canvas->fillRect(first - offset_x, row - offset_y, last - first + 1, 1);
+        pixels += last - first + 1;
+    }
+    return pixels;
+}
+
+uint32_t Display::fillDialCap(lgfx::LovyanGFX *canvas, const display_area_t *clip, int32_t offset_x, int32_t offset_y) {
+    uint32_t pixels = 0;
+    for (int32_t dy = -DISPLAY_LAYOUT_DIAL_CAP_R; dy <= DISPLAY_LAYOUT_DIAL_CAP_R; dy++) {
+        int32_t row = DISPLAY_LAYOUT_DIAL_Y + dy;
+        if (row < clip->y0 || row >= clip->y1)
+            continue;
+        int32_t dx = 0;
+        while ((dx + 1) * (dx + 1) + dy * dy <= DISPLAY_LAYOUT_DIAL_CAP_R * (DISPLAY_LAYOUT_DIAL_CAP_R + 1))
+            dx++;
+        int32_t first = std::max(DISPLAY_LAYOUT_DIAL_X - dx, clip->x0);
+        int32_t last = std::min(DISPLAY_LAYOUT_DIAL_X + dx, clip->x1 - 1);
+        if (first > last)
+            continue;
+        canvas->fillRect(first - offset_x, row - offset_y, last - first + 1, 1);
+        pixels += last - first + 1;
+    }
+    return pixels;
+}
+
+void Display::clearCells(display_element_t element, uint8_t index) {
+    // Blank exactly the area any string of the slot may cover, this also invalidates its cells
+    const display_slot_t *slot = &display_layout[element][index];
+    fillArea(slot->box_x, slot->box_y, slot->box_w, slot->box_h, TFT_BLACK);
+}
+
+void Display::invalidateCells(int32_t x, int32_t y, int32_t w, int32_t h) {
+    // Anything overlapping with this area will have to be redrawn completely the next time
+    for (uint8_t e = 0; e < DISPLAY_ELEMENTS_NR; e++) {
+        for (uint8_t i = 0; i < DISPLAY_STRINGS_PER_ELEMENT; i++) {
+            display_cells_t *cache = &cells[e][i];
+            if (cache->valid && (cache->x < x + w) && (x < cache->x + cache->w) &&
+                (cache->y < y + h) && (y < cache->y + cache->h)) {
+                cache->valid = false;
+            }
+        }
+    }
+    // The dial has no cells, it is drawn completely the next time
+    if ((DISPLAY_LAYOUT_DIAL_X - DISPLAY_LAYOUT_DIAL_R < x + w) && (x <= DISPLAY_LAYOUT_DIAL_X + DISPLAY_LAYOUT_DIAL_R) &&
+        (DISPLAY_LAYOUT_DIAL_Y - DISPLAY_LAYOUT_DIAL_R < y + h) && (y <= DISPLAY_LAYOUT_DIAL_Y + DISPLAY_LAYOUT_DIAL_R)) {
+        face_valid = false;
+    }
+}
+
+void Display::reportSavedBytes(display_element_t element) {
+    if (saved_bytes > 0) {
+        ESP_LOGD(TAG, "Element %d updated, %lu pixels drawn, %lu bytes saved", element, (unsigned long)drawn_pixels,
+                 (unsigned long)saved_bytes);
+    }
+    last_saved_bytes = saved_bytes;
+    last_drawn_pixels = drawn_pixels;
+    saved_bytes = 0;
+    drawn_pixels = 0;
+}
+
+void Display::initBackBuffers(void) {
+    for (uint8_t r = 0; r < DISPLAY_REGIONS_NR; r++) {
+        display_region_t *region = &regions[r];
+        // Every pixel needs DISPLAY_BACK_BUFFER_BPP bits and the buffer has to be DMA capable
+        size_t buffer_size = region->w * region->h * DISPLAY_BACK_BUFFER_BPP / 8;
+        region->dirty_nr = 0;
+
+        if (heap_caps_get_free_size(MALLOC_CAP_DMA) < buffer_size + DISPLAY_HEAP_RESERVE) {
+            ESP_LOGW(TAG, "Not enough memory for back buffer %d, drawing directly on the panel", r);
+            continue;
+        }
+        region->sprite = new lgfx::LGFX_Sprite(&lcd);
+        region->sprite->setColorDepth(DISPLAY_BACK_BUFFER_BPP);
+        if (region->sprite->createSprite(region->w, region->h) == nullptr) {
+            ESP_LOGW(TAG, "Back buffer %d could not be allocated, drawing directly on the panel", r);
+            delete region->sprite;
+            region->sprite = NULL;
+            continue;
+        }
+        #if DISPLAY_BACK_BUFFER_BPP == 4
+        region->sprite->createPalette(display_palettes[active_palette], DISPLAY_PALETTE_COLORS_NR);
+        #endif
+        region->sprite->fillSprite(canvasColor(region->sprite, 0));
+        back_buffer_bytes += buffer_size;
+        ESP_LOGI(TAG, "Back buffer %d allocated (%d bytes)", r, (int)buffer_size);
+    }
+    lcd.initDMA();
+
+    uint32_t screen_pixels = 0;
+    for (uint8_t r = 0; r < DISPLAY_REGIONS_NR; r++) {
+        screen_pixels += regions[r].w * regions[r].h;
+    }
+    ESP_LOGI(TAG, "Back buffers use %lu bytes, all regions would need %lu bytes in RGB565 and %lu bytes in 4 bpp",
+             (unsigned long)back_buffer_bytes, (unsigned long)(screen_pixels * 2), (unsigned long)(screen_pixels / 2));
+}
+
+display_region_t *Display::findRegion(int32_t x, int32_t y) {
+    for (uint8_t r = 0; r < DISPLAY_REGIONS_NR; r++) {
+        display_region_t *region = &regions[r];
+        if ((x >= region->x) && (x < region->x + region->w) && (y >= region->y) && (y < region->y + region->h)) {
+            return region;
+        }
+    }
+    return NULL;
+}
+
+void Display::markDirty(display_region_t *region, int32_t x, int32_t y, int32_t w, int32_t h) {
+    if (region == NULL || region->sprite == NULL)
+        return;
+
+    // Convert into region coordinates and clip against the back buffer
+    display_area_t area = {std::max(x - region->x, (int32_t)0), std::max(y - region->y, (int32_t)0),
+                           std::min(x + w - region->x, region->w), std::min(y + h - region->y, region->h)};
+    if (area.x1 <= area.x0 || area.y1 <= area.y0)
+        return;
+
+    // Areas which overlap or touch are merged. Small changes far apart, e.g. in the first and the last digit of the
+    // time, are kept separately, so that the pixels in between are not flushed. If there are too many areas, the new
+    // one is merged with the one whose bounding box grows least
+    for (;;) {
+        int8_t merge = -1;
+        uint32_t merge_growth = UINT32_MAX;
+        for (uint8_t i = 0; i < region->dirty_nr; i++) {
+            const display_area_t *dirty = &region->dirty[i];
+            if (dirty->x0 <= area.x1 && area.x0 <= dirty->x1 && dirty->y0 <= area.y1 && area.y0 <= dirty->y1) {
+                merge = i;
+                break;
+            }
+            if (region->dirty_nr == DISPLAY_DIRTY_AREAS_NR) {
+                uint32_t growth = (std::max(dirty->x1, area.x1) - std::min(dirty->x0, area.x0)) *
+                                  (std::max(dirty->y1, area.y1) - std::min(dirty->y0, area.y0)) -
+                                  (dirty->x1 - dirty->x0) * (dirty->y1 - dirty->y0);
+                if (growth < merge_growth) {
+                    merge = i;
+                    merge_growth = growth;
+                }
+            }
+        }
+        if (merge < 0)
+            break;
+        // The merged area may overlap with others now, so it is checked again
+        const display_area_t *dirty = &region->dirty[merge];
+        area = {std::min(dirty->x0, area.x0), std::min(dirty->y0, area.y0), std::max(dirty->x1, area.x1),
+                std::max(dirty->y1, area.y1)};
+        region->dirty[merge] = region->dirty[--region->dirty_nr];
+    }
+    region->dirty[region->dirty_nr++] = area;
+}
+
+void Display::fillArea(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+    if (color != TFT_BLACK)
+        command_shown = true;
+    waitFlush();
+    invalidateCells(x, y, w, h);
+    display_region_t *region = findRegion(x, y);
+    if (region != NULL && region->sprite != NULL) {
+        region->sprite->setColor(canvasColor(region->sprite, lcd.color16to24(color)));
+        region->sprite->fillRect(x - region->x, y - region->y, w, h);
+        markDirty(region, x, y, w, h);
+    } else {
+        lcd.setColor(canvasColor(&lcd, lcd.color16to24(color)));
+        lcd.fillRect(x, y, w, h);
+    }
+}
+
+void Display::flush(void) {
+    for (uint8_t r = 0; r < DISPLAY_REGIONS_NR; r++) {
+        display_region_t *region = &regions[r];
+        if (region->sprite == NULL || region->dirty_nr == 0)
+            continue;
+
+        if (!flush_pending) {
+            // The transaction is kept open until the DMA transfer has finished, see waitFlush()
+            lcd.startWrite();
+            flush_pending = true;
+        }
+        // The clip rectangle restricts the transfer to the dirty parts of the back buffer, line by line
+        for (uint8_t i = 0; i < region->dirty_nr; i++) {
+            const display_area_t *dirty = &region->dirty[i];
+            lcd.setClipRect(region->x + dirty->x0, region->y + dirty->y0, dirty->x1 - dirty->x0, dirty->y1 - dirty->y0);
+            #if DISPLAY_BACK_BUFFER_BPP == 4
+            // The palette indices are expanded to RGB565 on the way to the panel
+            lcd.pushImageDMA(region->x, region->y, region->w, region->h, region->sprite->getBuffer(),
+                             region->sprite->getColorDepth(), region->sprite->getPalette());
+            #else
+            lcd.pushImageDMA(region->x, region->y, region->w, region->h,
+                             static_cast<const lgfx::swap565_t *>(region->sprite->getBuffer()));
+            #endif
+            ESP_LOGD(TAG, "Flushing %d bytes of back buffer %d",
+                     (int)((dirty->x1 - dirty->x0) * (dirty->y1 - dirty->y0) * 2), r);
+        }
+        lcd.clearClipRect();
+        region->dirty_nr = 0;
+    }
+}
+
+uint32_t Display::canvasColor(lgfx::LovyanGFX *canvas, uint32_t rgb888) {
+    // The drawing functions of a palette back buffer take the index of the colour instead of the colour itself.
+    // Everywhere else the colour of the active palette is drawn
+    uint8_t index = findPaletteIndex(lcd.color24to16(rgb888));
+    if (DISPLAY_BACK_BUFFER_BPP == 4 && canvas != &lcd)
+        return index;
+    return lcd.color16to24(display_palettes[active_palette][index]);
+}
+
+uint8_t Display::findPaletteIndex(uint16_t rgb565) {
+    for (uint8_t i = 0; i < DISPLAY_PALETTE_COLORS_NR; i++) {
+        if (display_palettes[D_P_DAY][i] == rgb565)
+            return i;
+    }
+    ESP_LOGW(TAG, "Colour 0x%04X is not in the palette, drawing it black", rgb565);
+    return 0;
+}
+
+bool Display::isFlushPending(void) {
+    return flush_pending && lcd.dmaBusy();
+}
+
+void Display::waitFlush(void) {
+    // Fence: the back buffers must not be touched while the DMA is still reading from them
+    if (flush_pending) {
+        lcd.waitDMA();
+        lcd.endWrite();
+        flush_pending = false;
+    }
+}
+
+void Display::initDigitCache(void) {
+    const RLEfont *font = &Antonio_SemiBold75ptRLE;
+    size_t used_bytes = 0;
+
+    // The glyphs are copied into the back buffer of the time as they are, there is nothing to gain with RGB565 buffers
+    // or on the panel
+    const display_slot_t *slot = &display_layout[D_E_TIME][0];
+    display_region_t *region = findRegion(slot->box_x, slot->box_y);
+    if (DISPLAY_BACK_BUFFER_BPP != 4 || region == NULL || region->sprite == NULL) {
+        ESP_LOGI(TAG, "Digit cache only used with a 4 bpp back buffer");
+        return;
+    }
+
+    uint8_t fg = findPaletteIndex(TFT_WHITE);
+    for (uint8_t g = 0; g < DISPLAY_DIGIT_CACHE_GLYPHS_NR; g++) {
+        const RLEglyph *glyph = &font->glyph[g];
+        int32_t stride = (glyph->width + 1) / 2;
+        size_t size = stride * glyph->height;
+        if ((used_bytes + size > DISPLAY_DIGIT_CACHE_BUDGET) ||
+            (heap_caps_get_free_size(MALLOC_CAP_8BIT) < size + DISPLAY_HEAP_RESERVE)) {
+            // This glyph will be drawn from the font, maybe a smaller one still fits
+            continue;
+        }
+        uint8_t *pixels = (uint8_t *)heap_caps_malloc(size, MALLOC_CAP_8BIT);
+        if (pixels == NULL)
+            continue;
+
+        // Black is index 0, so only the foreground spans are filled in
+        memset(pixels, 0, size);
+        const uint8_t *span = &font->spans[glyph->spanOffset * RLE_SPAN_SIZE];
+        for (uint16_t s = 0; s < glyph->spanCount; s++, span += RLE_SPAN_SIZE) {
+            for (uint8_t row = span[1]; row < span[1] + span[3]; row++) {
+                for (uint8_t col = span[0]; col < span[0] + span[2]; col++) {
+                    pixels[row * stride + col / 2] |= (col & 1) ? fg : (fg << 4);
+                }
+            }
+        }
+        digit_cache[g] = pixels;
+        used_bytes += size;
+    }
+    digit_cache_bytes = used_bytes;
+    ESP_LOGI(TAG, "Digit cache uses %d of %d bytes", (int)used_bytes, DISPLAY_DIGIT_CACHE_BUDGET);
+}
+
+const uint8_t *Display::findCachedGlyph(lgfx::LovyanGFX *canvas, char c, const RLEfont *font) {
+    const RLEfont *time_font = &Antonio_SemiBold75ptRLE;
+    if (DISPLAY_BACK_BUFFER_BPP != 4 || canvas == &lcd || font != time_font || rleGetGlyph(font, c) == NULL)
+        return NULL;
+
+    // The cache was rendered white on black only
+    const lgfx::TextStyle &style = lcd.getTextStyle();
+    if (style.back_rgb888 != 0 || style.fore_rgb888 != lcd.color16to24(TFT_WHITE))
+        return NULL;
+    return digit_cache[(uint8_t)c - time_font->first];
+}
+
+static inline uint8_t getNibble(const uint8_t *row, int32_t x) {
+    return (x & 1) ? (row[x / 2] & 0x0F) : (row[x / 2] >> 4);
+}
+
+static inline void setNibble(uint8_t *row, int32_t x, uint8_t index) {
+    row[x / 2] = (x & 1) ? ((row[x / 2] & 0xF0) | index) : ((row[x / 2] & 0x0F) | (index << 4));
+}
+
+void Display::pushCachedGlyph(lgfx::LovyanGFX *canvas, const uint8_t *pixels, const RLEglyph *glyph, int32_t gx,
+                              int32_t gy, const display_area_t *clip) {
+    // Written straight into the buffer, so the clipping is done here. Inside a row whole bytes are copied, shifted by
+    // a nibble if the glyph starts on the other half of a byte than the back buffer
+    lgfx::LGFX_Sprite *sprite = static_cast<lgfx::LGFX_Sprite *>(canvas);
+    display_area_t area = {std::max(gx, (int32_t)0), std::max(gy, (int32_t)0),
+                           std::min(gx + glyph->width, sprite->width()), std::min(gy + glyph->height, sprite->height())};
+    if (clip != NULL) {
+        area = {std::max(area.x0, clip->x0), std::max(area.y0, clip->y0), std::min(area.x1, clip->x1),
+                std::min(area.y1, clip->y1)};
+    }
+    if (area.x0 >= area.x1 || area.y0 >= area.y1)
+        return;
+
+    uint8_t *buffer = static_cast<uint8_t *>(sprite->getBuffer());
+    int32_t stride = (sprite->width() + 1) / 2;
+    int32_t glyph_stride = (glyph->width + 1) / 2;
+    for (int32_t y = area.y0; y < area.y1; y++) {
+        const uint8_t *src = pixels + (y - gy) * glyph_stride;
+        uint8_t *dst = buffer + y * stride;
+        int32_t x = area.x0;
+        if (x & 1) {
+            setNibble(dst, x, getNibble(src, x - gx));
+            x++;
+        }
+        int32_t bytes = (area.x1 - x) / 2;
+        int32_t sx = x - gx;
+        if ((sx & 1) == 0) {
+            memcpy(dst + x / 2, src + sx / 2, bytes);
+        } else {
+            for (int32_t i = 0; i < bytes; i++) {
+                dst[x / 2 + i] = (uint8_t)(src[sx / 2 + i] << 4) | (src[sx / 2 + i + 1] >> 4);
+            }
+        }
+        x += bytes * 2;
+        if (x < area.x1)
+            setNibble(dst, x, getNibble(src, x - gx));
+    }
+}
+
+void Display::drawGlyph(lgfx::LovyanGFX *canvas, char c, int32_t x, int32_t y, const RLEfont *font,
+                        const display_area_t *clip) {
+    const RLEglyph *glyph = rleGetGlyph(font, c);
+    if (glyph == NULL)
+        return;
+
+    int32_t gx = x + glyph->xOffset;
+    int32_t gy = y + font->baseline + glyph->yOffset;
+    const uint8_t *pixels = findCachedGlyph(canvas, c, font);
+    if (pixels != NULL) {
+        // The cached block already holds the background of the bounding box
+        canvas->startWrite();
+        canvas->setColor(canvasColor(canvas, 0));
+        fillCellMargins(canvas, x, y, glyph, font);
+        canvas->endWrite();
+        pushCachedGlyph(canvas, pixels, glyph, gx, gy, clip);
+        digit_cache_hits++;
+        return;
+    }
+
+    // As with drawString, the background is only painted if it differs from the foreground
+    const lgfx::TextStyle &style = lcd.getTextStyle();
+    canvas->startWrite();
+    if (style.back_rgb888 != style.fore_rgb888) {
+        canvas->setColor(canvasColor(canvas, style.back_rgb888));
+        fillCellMargins(canvas, x, y, glyph, font);
+        fillGlyphBackground(canvas, gx, gy, glyph, font);
+    }
+    canvas->setColor(canvasColor(canvas, style.fore_rgb888));
+    const uint8_t *span = &font->spans[glyph->spanOffset * RLE_SPAN_SIZE];
+    for (uint16_t s = 0; s < glyph->spanCount; s++, span += RLE_SPAN_SIZE) {
+        if (span[3] == 1) {
+            canvas->writeFastHLine(gx + span[0], gy + span[1], span[2]);
         } else {
-            setBrightness(display_brightness_level);
+            canvas->writeFillRect(gx + span[0], gy + span[1], span[2], span[3]);
+        }
+    }
+    canvas->endWrite();
+}
+
+void Display::fillCellMargins(lgfx::LovyanGFX *canvas, int32_t x, int32_t y, const RLEglyph *glyph, const RLEfont *font) {
+    // Everything of the cell around the glyph bounding box, with the colour already set on the canvas
+    int32_t cell_w = glyph->xAdvance;
+    int32_t gx = x + glyph->xOffset;
+    int32_t gy = y + font->baseline + glyph->yOffset;
+
+    if (gy > y)
+        canvas->writeFillRect(x, y, cell_w, gy - y);
+    if (y + font->height > gy + glyph->height)
+        canvas->writeFillRect(x, gy + glyph->height, cell_w, y + font->height - gy - glyph->height);
+    if (gx > x)
+        canvas->writeFillRect(x, gy, gx - x, glyph->height);
+    if (x + cell_w > gx + glyph->width)
+        canvas->writeFillRect(gx + glyph->width, gy, x + cell_w - gx - glyph->width, glyph->height);
+}
+
+void Display::fillGlyphBackground(lgfx::LovyanGFX *canvas, int32_t gx, int32_t gy, const RLEglyph *glyph, const RLEfont *font) {
+    // The gaps between the foreground runs of each row are the background runs. Consecutive rows with the same gaps
+    // are merged into rectangles again, so a straight stem costs a few rectangles instead of one line per row.
+    // Runs beyond DISPLAY_RLE_RUNS_MAX are ignored: the gap gets wider, but the foreground is drawn on top anyway
+    uint8_t gaps[DISPLAY_RLE_RUNS_MAX + 1][2];
+    uint8_t band_gaps[DISPLAY_RLE_RUNS_MAX + 1][2];
+    uint8_t band_gaps_nr = 0;
+    int32_t band_start = 0;
+
+    for (int32_t row = 0; row <= glyph->height; row++) {
+        uint8_t gaps_nr = 0;
+        if (row < glyph->height) {
+            uint8_t runs[DISPLAY_RLE_RUNS_MAX][2];
+            uint8_t runs_nr;
+            getGlyphRuns(glyph, font, row, runs, &runs_nr);
+            uint8_t col = 0;
+            for (uint8_t r = 0; r < runs_nr; r++) {
+                if (runs[r][0] > col) {
+                    gaps[gaps_nr][0] = col;
+                    gaps[gaps_nr][1] = runs[r][0] - col;
+                    gaps_nr++;
+                }
+                col = std::max(col, runs[r][1]);
+            }
+            if (col < glyph->width) {
+                gaps[gaps_nr][0] = col;
+                gaps[gaps_nr][1] = glyph->width - col;
+                gaps_nr++;
+            }
+            if (row > 0 && gaps_nr == band_gaps_nr && memcmp(gaps, band_gaps, gaps_nr * 2) == 0)
+                continue;
+        }
+
+        // The gaps changed (or the glyph ended), so the band collected so far is drawn
+        for (uint8_t g = 0; g < band_gaps_nr; g++) {
+            canvas->writeFillRect(gx + band_gaps[g][0], gy + band_start, band_gaps[g][1], row - band_start);
+        }
+        memcpy(band_gaps, gaps, gaps_nr * 2);
+        band_gaps_nr = gaps_nr;
+        band_start = row;
+    }
+}
+
+bool Display::getGlyphRuns(const RLEglyph *glyph, const RLEfont *font, int32_t row, uint8_t runs[][2], uint8_t *runs_nr) {
+    // Start and end of the foreground runs of a glyph row, sorted by their start. Returns false if the row has more
+    // than DISPLAY_RLE_RUNS_MAX runs, the runs beyond are dropped
+    const uint8_t *spans = &font->spans[glyph->spanOffset * RLE_SPAN_SIZE];
+    bool complete = true;
+    *runs_nr = 0;
+    for (uint16_t s = 0; s < glyph->spanCount; s++) {
+        const uint8_t *span = &spans[s * RLE_SPAN_SIZE];
+        if (row < span[1] || row >= span[1] + span[3])
+            continue;
+        if (*runs_nr == DISPLAY_RLE_RUNS_MAX) {
+            complete = false;
+            continue;
+        }
+        uint8_t i = (*runs_nr)++;
+        while (i > 0 && runs[i - 1][0] > span[0]) {
+            runs[i][0] = runs[i - 1][0];
+            runs[i][1] = runs[i - 1][1];
+            i--;
+        }
+        runs[i][0] = span[0];
+        runs[i][1] = span[0] + span[2];
+    }
+    return complete;
+}
+
+int32_t Display::drawGlyphDiff(lgfx::LovyanGFX *canvas, char old_c, char new_c, int32_t x, int32_t y, const RLEfont *font,
+                               display_area_t *changed) {
+    // Only the pixels where the old and the new glyph differ are written: foreground where the new glyph has been
+    // added, background where the old one has been removed. Rows with the same differences are merged into
+    // rectangles. Returns the number of pixels written, or -1 if a row has too many runs. The cell has to be drawn
+    // completely then
+    const RLEglyph *glyphs[2] = {rleGetGlyph(font, old_c), rleGetGlyph(font, new_c)};
+    if (glyphs[0] == NULL || glyphs[1] == NULL)
+        return -1;
+    const lgfx::TextStyle &style = lcd.getTextStyle();
+    const uint32_t colors[2] = {canvasColor(canvas, style.back_rgb888), canvasColor(canvas, style.fore_rgb888)};
+
+    // Each run is start, width and whether it is foreground
+    int16_t diff[DISPLAY_RLE_RUNS_MAX * 4][3];
+    int16_t band_diff[DISPLAY_RLE_RUNS_MAX * 4][3];
+    uint8_t band_diff_nr = 0;
+    int32_t band_start = 0;
+    int32_t pixels = 0;
+    *changed = {INT32_MAX, INT32_MAX, INT32_MIN, INT32_MIN};
+
+    canvas->startWrite();
+    for (int32_t row = 0; row <= font->height; row++) {
+        uint8_t diff_nr = 0;
+        if (row < font->height) {
+            // Runs of both glyphs in cell coordinates, followed by all their borders in ascending order
+            int16_t runs[2][DISPLAY_RLE_RUNS_MAX][2];
+            uint8_t runs_nr[2] = {0, 0};
+            int16_t borders[DISPLAY_RLE_RUNS_MAX * 4];
+            uint8_t borders_nr = 0;
+            for (uint8_t g = 0; g < 2; g++) {
+                int32_t glyph_row = row - font->baseline - glyphs[g]->yOffset;
+                if (glyph_row < 0 || glyph_row >= glyphs[g]->height)
+                    continue;
+                uint8_t glyph_runs[DISPLAY_RLE_RUNS_MAX][2];
+                if (!getGlyphRuns(glyphs[g], font, glyph_row, glyph_runs, &runs_nr[g])) {
+                    canvas->endWrite();
+                    return -1;
+                }
+                for (uint8_t r = 0; r < runs_nr[g]; r++) {
+                    for (uint8_t e = 0; e < 2; e++) {
+                        int16_t border = glyph_runs[r][e] + glyphs[g]->xOffset;
+                        runs[g][r][e] = border;
+                        uint8_t i = borders_nr++;
+                        while (i > 0 && borders[i - 1] > border) {
+                            borders[i] = borders[i - 1];
+                            i--;
+                        }
+                        borders[i] = border;
+                    }
+                }
+            }
+
+            // Between two borders a pixel is either covered by a glyph or not
+            uint8_t next[2] = {0, 0};
+            for (uint8_t b = 0; b + 1 < borders_nr; b++) {
+                int16_t start = borders[b];
+                int16_t end = borders[b + 1];
+                if (start == end)
+                    continue;
+                bool covered[2];
+                for (uint8_t g = 0; g < 2; g++) {
+                    while (next[g] < runs_nr[g] && runs[g][next[g]][1] <= start) next[g]++;
+                    covered[g] = (next[g] < runs_nr[g]) && (runs[g][next[g]][0] <= start);
+                }
+                if (covered[0] == covered[1])
+                    continue;
+                if (diff_nr > 0 && diff[diff_nr - 1][0] + diff[diff_nr - 1][1] == start &&
+                    diff[diff_nr - 1][2] == covered[1]) {
+                    diff[diff_nr - 1][1] += end - start;
+                } else {
+                    diff[diff_nr][0] = start;
+                    diff[diff_nr][1] = end - start;
+                    diff[diff_nr][2] = covered[1];
+                    diff_nr++;
+                }
+            }
+            if (row > 0 && diff_nr == band_diff_nr && memcmp(diff, band_diff, diff_nr * sizeof(diff[0])) == 0)
+                continue;
         }
+
+        // The differences changed (or the cell ended), so the band collected so far is drawn
+        for (uint8_t d = 0; d < band_diff_nr; d++) {
+            int32_t run_x = x + band_diff[d][0];
+            int32_t run_y = y + band_start;
+            int32_t run_h = row - band_start;
+            canvas->setColor(colors[band_diff[d][2]]);
+            canvas->writeFillRect(run_x, run_y, band_diff[d][1], run_h);
+            pixels += band_diff[d][1] * run_h;
+            changed->x0 = std::min(changed->x0, run_x);
+            changed->y0 = std::min(changed->y0, run_y);
+            changed->x1 = std::max(changed->x1, run_x + band_diff[d][1]);
+            changed->y1 = std::max(changed->y1, run_y + run_h);
+        }
+        memcpy(band_diff, diff, diff_nr * sizeof(diff[0]));
+        band_diff_nr = diff_nr;
+        band_start = row;
+    }
+    canvas->endWrite();
+    return pixels;
+}
+
+void Display::controlBrightness(uint32_t events) {
+    bool settled = light.getState()->settled;
+    sampleLight();
+    const light_state_t *light_state = light.getState();
+    if (!light_state->valid) {
+        // Without a sample the brightness stays as it is, the first one follows soon
+        return;
+    }
+    if (!settled && light_state->settled) {
+        ESP_LOGD(TAG, "Ambient light %lu mlux settled after %lld ms: brightness %u, %lu blocks, %lu outliers, "
+                      "brightness task woken up %lu times",
+                 (unsigned long)light_state->lux_milli, (long long)(light_state->latency_us / 1000),
+                 light_state->brightness, (unsigned long)light_state->blocks, (unsigned long)light_state->outliers,
+                 (unsigned long)brightness_wakeups);
+    }
+
+    // The fade type requested by the last user action is used once, further changes are ambient ones
+    display_fade_t fade = next_fade;
+    next_fade = D_F_AMBIENT;
+
+    uint16_t brightness = light_state->brightness;
+    if (max_brightness_requested) {
+        brightness = DISPLAY_BRIGHTNESS_MAX;
+    } else if (increased_brightness_requested) {
+        brightness = std::max(brightness * DISPLAY_BRIGHTNESS_INC_FACTOR, DISPLAY_BRIGHTNESS_INC_MIN);
+        brightness = std::min(brightness, (uint16_t)DISPLAY_BRIGHTNESS_MAX);
     }
+    setBrightness(brightness, fade);
+    // When it gets dark, the UI turns red
+    setPalette(light_state->night ? D_P_NIGHT : D_P_DAY);
 }
 
-void Display::setBrightness(uint8_t brightness_level) {
-    // In case we have an increased brightness level, we saturate it to the last level
-    if (brightness_level > DISPLAY_BRIGHTNESS_LEVELS_NR)
-        brightness_level = DISPLAY_BRIGHTNESS_LEVELS_NR;
+void Display::initBacklight(void) {
+    // The backlight is driven here instead of by LovyanGFX, to make use of the LEDC fade engine
+    ledc_timer_config_t timer_config = {
+        .speed_mode = DISPLAY_BL_LEDC_MODE,
+        .duty_resolution = DISPLAY_BL_DUTY_RESOLUTION,
+        .timer_num = DISPLAY_BL_LEDC_TIMER,
+        .freq_hz = DISPLAY_BL_FREQ_HZ,
+        .clk_cfg = LEDC_AUTO_CLK,
+    };
+    ESP_ERROR_CHECK(ledc_timer_config(&timer_config));
+    ledc_channel_config_t channel_config = {
+        .gpio_num = DISPLAY_BL_GPIO,
+        .speed_mode = DISPLAY_BL_LEDC_MODE,
+        .channel = DISPLAY_BL_LEDC_CHANNEL,
+        .intr_type = LEDC_INTR_DISABLE,
+        .timer_sel = DISPLAY_BL_LEDC_TIMER,
+        .duty = 0,
+        .hpoint = 0,
+    };
+    ESP_ERROR_CHECK(ledc_channel_config(&channel_config));
+    ESP_ERROR_CHECK(ledc_fade_func_install(0));
+}
 
-    lcd.setBrightness(display_light_brightness[brightness_level]);
+void Display::setBrightness(uint16_t brightness, display_fade_t fade) {
+    // The brightness is given in 1/1000 of the full duty
+    uint32_t duty = (brightness * ((1 << DISPLAY_BL_DUTY_RESOLUTION) - 1)) / 1000;
+    if (duty != backlight_duty) {
+        if (duty > 0) {
+            // Wake the panel up first, it will be updated while the backlight fades in
+            setPanelSleep(false);
+        }
+        // The fade runs in hardware, the CPU is not involved until it is finished
+        #if SOC_LEDC_SUPPORT_FADE_STOP
+        ledc_fade_stop(DISPLAY_BL_LEDC_MODE, DISPLAY_BL_LEDC_CHANNEL);
+        #endif
+        ESP_ERROR_CHECK(ledc_set_fade_time_and_start(DISPLAY_BL_LEDC_MODE, DISPLAY_BL_LEDC_CHANNEL, duty,
+                                                     display_fade_time_ms[fade], LEDC_FADE_NO_WAIT));
+        backlight_duty = duty;
+    } else if (duty == 0 && ledc_get_duty(DISPLAY_BL_LEDC_MODE, DISPLAY_BL_LEDC_CHANNEL) == 0) {
+        // Nobody can see the panel with the backlight off, so it may sleep as well. This is done only once the fade
+        // out has finished, i.e. in one of the next cycles
+        setPanelSleep(true);
+    }
 }
 
 void Display::setMaxBrightness(bool request_max_brightness) {
+    next_fade = D_F_MAX;
     max_brightness_requested = request_max_brightness;
     increased_brightness_requested = false;
     // This is to trigger an immediate change of brightness in monitorBrightnessTask
-    bool queue_event = true;
-    xQueueSend(queue, &queue_event, portMAX_DELAY);
+    xTaskNotify(brightness_task, DISPLAY_LIGHT_EVENT_REQUEST, eSetBits);
 }
 
 void Display::setIncreasedBrightness(bool request_inc_brightness) {
      // This is to trigger an immediate change of brightness in monitorBrightnessTask
     if (increased_brightness_requested != request_inc_brightness) {
-        bool queue_event = true;
-        xQueueSend(queue, &queue_event, portMAX_DELAY);
+        next_fade = D_F_INCREASED;
+        xTaskNotify(brightness_task, DISPLAY_LIGHT_EVENT_REQUEST, eSetBits);
     }
     increased_brightness_requested = request_inc_brightness;
     max_brightness_requested = false;
 }
 
+void Display::sampleAmbientLight(void) {
+    // Called with the minute update of the time. A light which has changed since is tracked from here on
+    xTaskNotify(brightness_task, DISPLAY_LIGHT_EVENT_SAMPLE, eSetBits);
+}
+
 bool Display::isDisplayOn(void) {
-    return (display_brightness_level > 0 || increased_brightness_requested);
+    return (!light.getState()->dark || increased_brightness_requested);
+}
+
+const light_state_t *Display::getLightState(void) {
+    return light.getState();
+}
+
+bool Display::isNightPalette(void) {
+    return (active_palette == D_P_NIGHT);
+}
+
+uint32_t Display::getSavedBytes(void) {
+    return last_saved_bytes;
+}
+
+void Display::setDigitRoll(bool enable) {
+    roll_enabled = enable;
+}
+
+// Takes effect with the next update of the time
+void Display::setAnalogFace(bool enable) {
+    analog_requested = enable;
+}
+
+bool Display::isRolling(void) {
+    return roll_active;
+}
+
+uint32_t Display::getDroppedFrames(void) {
+    return dropped_frames;
+}
+
+uint32_t Display::getDrawnPixels(void) {
+    return last_drawn_pixels;
+}
+
+uint32_t Display::getMergedCommands(void) {
+    return merged_commands;
+}
+
+// Copies a row of the screen as RGB565 out of the back buffers, for a snapshot. The panel itself cannot be read, its
+// MISO line is not connected. So this fails if a part of the row is drawn directly on the panel. Drawing may go on
+// meanwhile, rows read at different times may show different frames
+bool Display::readScreenRow(int32_t y, uint16_t *pixels) {
+    int32_t covered = 0;
+    for (uint8_t r = 0; r < DISPLAY_REGIONS_NR; r++) {
+        const display_region_t *region = &regions[r];
+        if (y < region->y || y >= region->y + region->h)
+            continue;
+        if (region->sprite == NULL)
+            return false;
+        const uint8_t *row = (const uint8_t *)region->sprite->getBuffer() +
+                             (y - region->y) * region->w * DISPLAY_BACK_BUFFER_BPP / 8;
+        for (int32_t x = 0; x < region->w; x++) {
+            #if DISPLAY_BACK_BUFFER_BPP == 4
+            // Palette indices, the left pixel in the upper nibble
+            uint8_t index = (x & 1) ? (row[x >> 1] & 0x0F) : (row[x >> 1] >> 4);
+            pixels[region->x + x] = display_palettes[active_palette][index];
+            #else
+            // RGB565 with the bytes swapped, as sent to the panel
+            pixels[region->x + x] = (row[2 * x] << 8) | row[2 * x + 1];
+            #endif
+        }
+        covered += region->w;
+    }
+    return (covered == DISPLAY_WIDTH);
+}
+
+uint32_t Display::getBackBufferBytes(void) {
+    return back_buffer_bytes;
+}
+
+uint32_t Display::getDigitCacheBytes(void) {
+    return digit_cache_bytes;
 }
@@ -2,11 +2,50 @@
 #define _INCLUDE_DISPLAY_HPP
 
 #include "freertos/queue.h"
+#include "freertos/task.h"
 #include "esp_adc/adc_oneshot.h"
+#include "ambient_light.hpp"
 #include "lgfx_ili9341.hpp"
 #include "mqtt_config.hpp"
+#include "rle_font.hpp"
 
-#define DISPLAY_BRIGHTNESS_LEVELS_NR    4  // Not including the off-level!
+#define DISPLAY_BRIGHTNESS_MAX          392  // 1/1000 of the full duty, on alarm
+#define DISPLAY_BRIGHTNESS_INC_FACTOR   4    // On user interaction the brightness for the ambient light is raised
+#define DISPLAY_BRIGHTNESS_INC_MIN      4    // by this factor, to at least this
+#define DISPLAY_FADE_TYPES_NR           3  // Number of entries in display_fade_t
+#define DISPLAY_BL_LEDC_MODE            LEDC_LOW_SPEED_MODE
+#define DISPLAY_BL_LEDC_TIMER           LEDC_TIMER_0
+#define DISPLAY_BL_LEDC_CHANNEL         LEDC_CHANNEL_0
+#define DISPLAY_BL_DUTY_RESOLUTION      LEDC_TIMER_10_BIT
+#define DISPLAY_BL_FREQ_HZ              44100
+#define DISPLAY_LIGHT_SETTLED_PERIOD_MS 300000  // Longest sleep while the light is settled, see sampleAmbientLight
+#define DISPLAY_LIGHT_FADE_PERIOD_MS    1000  // While the backlight fades out, until the panel may sleep
+#define DISPLAY_LIGHT_TRACK_PERIOD_MS   200   // While the light changes
+#define DISPLAY_LIGHT_OVERSAMPLING      16    // Reads per block
+#define DISPLAY_LIGHT_EVENT_REQUEST     (1 << 0)  // Notifications of the brightness task
+#define DISPLAY_LIGHT_EVENT_SAMPLE      (1 << 1)  // The light is to be sampled, e.g. along with the time update
+#define DISPLAY_ELEMENTS_NR             10 // Number of entries in display_element_t
+#define DISPLAY_STRINGS_PER_ELEMENT     3  // Maximum number of strings drawn for a single element
+#define DISPLAY_CELLS_MAX               8  // Maximum string length (including terminator) tracked by the compositor
+#define DISPLAY_WIDTH                   320
+#define DISPLAY_HEIGHT                  240
+#define DISPLAY_REGIONS_NR              2
+#define DISPLAY_STATUS_ROW_Y            145  // Border between the time row and the status row
+#define DISPLAY_DIRTY_AREAS_NR          4    // Separate areas of a back buffer flushed, e.g. one per changed digit
+#ifndef DISPLAY_BACK_BUFFER_BPP
+#define DISPLAY_BACK_BUFFER_BPP         4    // 4: palette of DISPLAY_PALETTE_COLORS_NR colours, 16: RGB565
+#endif
+#define DISPLAY_PALETTE_COLORS_NR       7    // Colours of each palette in display_palettes, at most 16
+#define DISPLAY_PALETTES_NR             2    // Number of entries in display_palette_t
+#define DISPLAY_HEAP_RESERVE            (64 * 1024)  // Heap which must remain free (WiFi etc.) after allocating back buffers
+#define DISPLAY_DIGIT_CACHE_BUDGET      (32 * 1024)  // Maximum RAM used for pre-rasterized time glyphs. 0 disables the cache
+#define DISPLAY_DIGIT_CACHE_GLYPHS_NR   11           // '0' to '9' and ':'
+#define DISPLAY_RENDER_TASK_STACK       5120
+#define DISPLAY_RLE_RUNS_MAX            16  // Foreground runs per glyph row considered when deriving the background
+#define DISPLAY_ROLL_FRAMES_NR          10     // Frames of the rolling digits animation of the time
+#define DISPLAY_ROLL_FRAME_PERIOD_MS    33     // About 30 fps
+#define DISPLAY_ROLL_FRAME_BUDGET_PX    20000  // Pixels flushed per frame. Further digits change without animation
+#define DISPLAY_HANDS_NR                2      // Hour and minute hand of the analog face
 
 #define DISPLAY_SYMBOL_WIFI_ON   ";"
 #define DISPLAY_SYMBOL_WIFI_OFF  "<"
@@ -34,6 +73,19 @@ typedef enum {
     D_E_AUDIO,
 } display_element_t;
 
+// Reason of a backlight change, each one fades with its own duration
+typedef enum {
+    D_F_AMBIENT = 0,
+    D_F_INCREASED,
+    D_F_MAX,
+} display_fade_t;
+
+// Colours the whole UI is drawn with. The night palette is a dim red one
+typedef enum {
+    D_P_DAY = 0,
+    D_P_NIGHT,
+} display_palette_t;
+
 typedef enum {
     D_A_OFF = 0,
     D_A_ON,
@@ -43,21 +95,189 @@ typedef enum {
     D_A_TWO_BARS,
 } display_action_t;
 
+// Copy of an updateContent request, so that it can be rendered later in the render task
+typedef struct {
+    display_element_t element;
+    display_action_t action;
+    bool with_value;   // Which of the updateContent variants has been requested
+    bool value_valid;  // false if NULL has been passed as value
+    union {
+        clock_time_t time;
+        uint16_t seconds;  // Only for D_E_SNOOZE_TIME
+    } value;
+} display_command_t;
+
+// Last rendered state of a string on the screen. Used to push only the glyph cells which actually changed
+typedef struct {
+    char text[DISPLAY_CELLS_MAX];
+    uint32_t color;
+    int32_t x;  // Top left corner of the whole string
+    int32_t y;
+    int32_t w;
+    int32_t h;
+    bool valid;
+} display_cells_t;
+
+// Rectangle in screen coordinates, x1 and y1 excluded
+typedef struct {
+    int32_t x0;
+    int32_t y0;
+    int32_t x1;
+    int32_t y1;
+} display_area_t;
+
+// Hand or tick of the analog face: a quadrilateral along a direction of the dial, from the inner to the outer radius
+typedef struct {
+    int16_t inner;        // Pixels from the center, negative for a hand reaching beyond the axis
+    int16_t outer;
+    uint8_t inner_width;  // Half width at each end, in 1/16 pixels
+    uint8_t outer_width;
+} display_dial_shape_t;
+
+// Screen area with an optional off-screen back buffer which is flushed to the panel via DMA
+typedef struct {
+    int32_t x;
+    int32_t y;
+    int32_t w;
+    int32_t h;
+    lgfx::LGFX_Sprite *sprite;  // NULL if this region is drawn directly on the panel
+    display_area_t dirty[DISPLAY_DIRTY_AREAS_NR];  // Areas of the back buffer pending to be flushed, in region
+    uint8_t dirty_nr;                              // coordinates. They do not overlap
+} display_region_t;
+
 class Display {
     LGFX_ILI9341 lcd;
     adc_oneshot_unit_handle_t adc1_handle;
-    const uint16_t display_light_thd_down[DISPLAY_BRIGHTNESS_LEVELS_NR] = {24, 25, 60, 100};
-    const uint16_t display_light_thd_up[DISPLAY_BRIGHTNESS_LEVELS_NR] = {30, 35, 80, 120};
-    const uint8_t display_light_brightness[DISPLAY_BRIGHTNESS_LEVELS_NR + 1] = {0, 1, 10, 50, 100};
-    uint8_t display_brightness_level = 2;
+    uint16_t light_samples[DISPLAY_LIGHT_OVERSAMPLING];
+    AmbientLight light;
     bool max_brightness_requested = false;
     bool increased_brightness_requested = false;
-    QueueHandle_t queue;
+    // Fade durations for ambient light changes, increased brightness on user interaction and max brightness on alarm
+    const uint16_t display_fade_time_ms[DISPLAY_FADE_TYPES_NR] = {1000, 250, 600};
+    display_fade_t next_fade = D_F_AMBIENT;
+    uint32_t backlight_duty = 0;  // Target of the last fade
+    TaskHandle_t brightness_task = NULL;
+    uint32_t brightness_wakeups = 0;
     bool show_alarm = false;
+    display_cells_t cells[DISPLAY_ELEMENTS_NR][DISPLAY_STRINGS_PER_ELEMENT] = {};
+    uint32_t saved_bytes = 0;       // Bytes not pushed over SPI during the ongoing update
+    uint32_t last_saved_bytes = 0;  // Bytes not pushed over SPI during the last finished update
+    uint32_t drawn_pixels = 0;      // Pixels of glyph cells written during the ongoing update
+    uint32_t last_drawn_pixels = 0; // Pixels of glyph cells written during the last finished update
+    // Time row and status row. They must not overlap, and no string may cross the border between them (checked at
+    // compile time, see display_layout.hpp)
+    display_region_t regions[DISPLAY_REGIONS_NR] = {
+        {0, 0, DISPLAY_WIDTH, DISPLAY_STATUS_ROW_Y, NULL, {}, 0},
+        {0, DISPLAY_STATUS_ROW_Y, DISPLAY_WIDTH, DISPLAY_HEIGHT - DISPLAY_STATUS_ROW_Y, NULL, {}, 0},
+    };
+    bool flush_pending = false;
+    // All colours of the UI. Elements are drawn with the day colours, which are mapped to the same entry of the
+    // active palette. In 4 bpp back buffers the pixels are the indices of the entries and only expanded to RGB565
+    // while they are flushed, so switching the palette just pushes the buffers again. Black comes first, so that a
+    // new buffer is cleared already
+    const uint16_t display_palettes[DISPLAY_PALETTES_NR][DISPLAY_PALETTE_COLORS_NR] = {
+        {TFT_BLACK, TFT_WHITE, TFT_DARKGRAY, TFT_LIGHTGRAY, TFT_ORANGE, TFT_RED, TFT_YELLOW},
+        {TFT_BLACK, 0xB000, 0x3000, 0x6000, 0x8000, 0x5000, 0x9000},
+    };
+    display_palette_t active_palette = D_P_DAY;
+    display_palette_t palette_requested = D_P_DAY;
+    uint32_t back_buffer_bytes = 0;
+    uint32_t digit_cache_bytes = 0;
+    // Glyphs of the time font as 4 bpp palette indices, white on black, laid out like the back buffer: rows of whole
+    // bytes with the left pixel in the upper nibble. They do not depend on the palette, the night one uses them too
+    uint8_t *digit_cache[DISPLAY_DIGIT_CACHE_GLYPHS_NR] = {};
+    uint8_t digit_cache_hits = 0;
+    // Commands waiting for the render task. Only the latest command of each element is kept, and the elements are
+    // rendered in the order of their last update. The queue can never hold more than one entry per element
+    TaskHandle_t render_task = NULL;
+    portMUX_TYPE render_mux = portMUX_INITIALIZER_UNLOCKED;
+    display_command_t pending_commands[DISPLAY_ELEMENTS_NR] = {};
+    display_element_t render_queue[DISPLAY_ELEMENTS_NR];
+    uint8_t render_queue_len = 0;
+    uint32_t merged_commands = 0;
+    uint8_t frame_depth = 0;       // Nesting level of beginFrame(), commands are held back while a frame is open
+    // Last command rendered for each element, in the order of rendering. Where the screen is not kept in a 4 bpp
+    // back buffer, a palette switch renders the ones which left something on the screen again
+    display_command_t rendered_commands[DISPLAY_ELEMENTS_NR] = {};
+    display_element_t rendered_order[DISPLAY_ELEMENTS_NR];
+    bool rendered_shown[DISPLAY_ELEMENTS_NR] = {};
+    uint8_t rendered_nr = 0;
+    bool command_shown = false;  // The command being rendered has drawn more than the background
+    int64_t last_frame_time_us = 0;
+    // The panel is put to sleep while the backlight is off. Commands keep being queued (and merged) meanwhile, and
+    // are replayed once it wakes up
+    bool panel_sleep_requested = false;
+    bool panel_sleeping = false;
+    // Rolling digits of the time: the old digit moves up and out of its cell, the new one comes in from below. Only
+    // the rolling cells are drawn into the back buffer and flushed in every frame
+    bool roll_enabled = false;
+    bool roll_active = false;
+    char roll_from[DISPLAY_CELLS_MAX] = {};  // Old glyph of each cell, '\0' if the cell does not roll
+    char roll_to[DISPLAY_CELLS_MAX] = {};
+    int32_t roll_x[DISPLAY_CELLS_MAX] = {};
+    uint8_t roll_frame = 0;  // Last frame drawn
+    int64_t roll_start_us = 0;
+    lgfx::TextStyle roll_style;
+    uint32_t dropped_frames = 0;
+    // Analog face instead of the digits. Only the parts of the dial around the hands which moved are drawn again
+    bool analog_requested = false;
+    bool analog_active = false;
+    bool time_drawn = false;  // Either face has been drawn at least once
+    bool face_valid = false;  // Dial drawn completely, with the hands below
+    uint8_t hand_positions[DISPLAY_HANDS_NR] = {};
+    uint32_t hand_color = 0;
 
     static void monitorBrightnessTask(void *pvParameter);
-    void setBrightness(uint8_t brightness_level);
-    void controlBrightness(void);
+    void sampleLight(void);
+    void initLightSensor(void);
+    static void renderTask(void *pvParameter);
+    void postCommand(const display_command_t *command);
+    bool takeCommand(display_command_t *command);
+    void setPanelSleep(bool sleep);
+    void updatePanelPower(void);
+    void setPalette(display_palette_t palette);
+    void updatePalette(void);
+    void renderCommand(const display_command_t *command);
+    void rememberCommand(const display_command_t *command);
+    void replayCommands(void);
+    void renderContent(display_element_t element, void *value, display_action_t action);
+    void renderContent(display_element_t element, display_action_t action);
+    bool startRoll(const char *text);
+    void rollTime(void);
+    void finishRoll(void);
+    void drawRollFrame(uint8_t frame);
+    TickType_t getRollWait(void);
+    void initBacklight(void);
+    void setBrightness(uint16_t brightness, display_fade_t fade);
+    void controlBrightness(uint32_t events);
+    void drawCells(display_element_t element, uint8_t index, const char *text);
+    void clearCells(display_element_t element, uint8_t index);
+    void drawCountdown(uint16_t seconds);
+    void switchFace(void);
+    void drawAnalogFace(const clock_time_t *time);
+    void getDialShapeBounds(const display_dial_shape_t *shape, uint8_t position, display_area_t *bounds);
+    uint32_t fillDialShape(lgfx::LovyanGFX *canvas, const display_dial_shape_t *shape, uint8_t position,
+                           const display_area_t *clip, int32_t offset_x, int32_t offset_y);
+    uint32_t fillDialCap(lgfx::LovyanGFX *canvas, const display_area_t *clip, int32_t offset_x, int32_t offset_y);
+    void invalidateCells(int32_t x, int32_t y, int32_t w, int32_t h);
+    void reportSavedBytes(display_element_t element);
+    void initBackBuffers(void);
+    display_region_t *findRegion(int32_t x, int32_t y);
+    void markDirty(display_region_t *region, int32_t x, int32_t y, int32_t w, int32_t h);
+    void fillArea(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color);
+    void flush(void);
+    uint32_t canvasColor(lgfx::LovyanGFX *canvas, uint32_t rgb888);
+    uint8_t findPaletteIndex(uint16_t rgb565);
+    void initDigitCache(void);
+    const uint8_t *findCachedGlyph(lgfx::LovyanGFX *canvas, char c, const RLEfont *font);
+    void pushCachedGlyph(lgfx::LovyanGFX *canvas, const uint8_t *pixels, const RLEglyph *glyph, int32_t gx, int32_t gy,
+                         const display_area_t *clip);
+    void drawGlyph(lgfx::LovyanGFX *canvas, char c, int32_t x, int32_t y, const RLEfont *font, const display_area_t *clip);
+    void fillCellMargins(lgfx::LovyanGFX *canvas, int32_t x, int32_t y, const RLEglyph *glyph, const RLEfont *font);
+    void fillGlyphBackground(lgfx::LovyanGFX *canvas, int32_t gx, int32_t gy, const RLEglyph *glyph, const RLEfont *font);
+    bool getGlyphRuns(const RLEglyph *glyph, const RLEfont *font, int32_t row, uint8_t runs[][2], uint8_t *runs_nr);
+    int32_t drawGlyphDiff(lgfx::LovyanGFX *canvas, char old_c, char new_c, int32_t x, int32_t y, const RLEfont *font,
+                          display_area_t *changed);
 
    public:
     void init(void);
@@ -66,6 +286,24 @@ class Display {
     void setMaxBrightness(bool request_max_brightness);
     void setIncreasedBrightness(bool request_inc_brightness);
     bool isDisplayOn(void);
+    void sampleAmbientLight(void);
+    const light_state_t *getLightState(void);
+    bool isNightPalette(void);
+    uint32_t getSavedBytes(void);
+    uint32_t getDrawnPixels(void);
+    uint32_t getMergedCommands(void);
+    uint32_t getBackBufferBytes(void);
+    uint32_t getDigitCacheBytes(void);
+    bool readScreenRow(int32_t y, uint16_t *pixels);
+    void beginFrame(void);
+    void endFrame(void);
+    int64_t getLastFrameTime(void);
+    void setDigitRoll(bool enable);
+    bool isRolling(void);
+    void setAnalogFace(bool enable);
+    uint32_t getDroppedFrames(void);
+    bool isFlushPending(void);
+    void waitFlush(void);
 };
 
 #endif // _INCLUDE_DISPLAY_HPP
\ No newline at end of file
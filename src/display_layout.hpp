@@ -0,0 +1,188 @@
+#ifndef _INCLUDE_DISPLAY_LAYOUT_HPP
+#define _INCLUDE_DISPLAY_LAYOUT_HPP
+
+#include "display.hpp"
+#include "Antonio_SemiBold75ptRLE.h"
+#include "Antonio_Regular26ptRLE.h"
+#include "Antonio_Light16ptRLE.h"
+
+// Screen layout of all the strings drawn by Display, indexed like the cells: [element][string index]. Everything is
+// resolved at compile time, including the area a slot may cover, so nothing has to be measured while rendering
+typedef struct {
+    int16_t x;             // Anchor of the string, interpreted according to datum
+    int16_t y;
+    uint8_t datum;
+    const RLEfont *font;
+    int16_t box_x;         // Largest area any string of this slot may cover, glyphs reaching beyond their cell
+    int16_t box_y;         // included. Blanking the slot clears exactly this area
+    int16_t box_w;
+    int16_t box_h;
+    uint8_t overhang_left;  // Maximum number of pixels the glyphs reach beyond the string
+    uint8_t overhang_right;
+} display_slot_t;
+
+// Maximum number of pixels the glyphs of a set reach beyond the left (right) border of their cell
+constexpr int16_t displayOverhang(const RLEfont *font, const char *glyphs, bool right) {
+    int16_t overhang = 0;
+    for (; *glyphs; glyphs++) {
+        const RLEglyph *glyph = rleGetGlyph(font, *glyphs);
+        if (glyph == NULL || glyph->width == 0)
+            continue;
+        int16_t beyond = right ? glyph->xOffset + glyph->width - glyph->xAdvance : -glyph->xOffset;
+        if (beyond > overhang)
+            overhang = beyond;
+    }
+    return overhang;
+}
+
+// Slot showing strings which are never wider than widest and only consist of the characters in glyphs. The datum is
+// resolved the same way as drawString does
+constexpr display_slot_t displaySlot(int16_t x, int16_t y, uint8_t datum, const RLEfont *font, const char *widest,
+                                     const char *glyphs) {
+    int16_t w = rleTextWidth(font, widest);
+    int16_t h = font->height;
+    int16_t left = x;
+    int16_t top = y;
+    if (datum & top_center) {
+        left -= w >> 1;
+    } else if (datum & top_right) {
+        left -= w;
+    }
+    if (datum & middle_left) {
+        top -= h >> 1;
+    } else if (datum & bottom_left) {
+        top -= h;
+    }
+    int16_t overhang_left = displayOverhang(font, glyphs, false);
+    int16_t overhang_right = displayOverhang(font, glyphs, true);
+    return {x, y, datum, font, (int16_t)(left - overhang_left), top, (int16_t)(w + overhang_left + overhang_right), h,
+            (uint8_t)overhang_left, (uint8_t)overhang_right};
+}
+
+// Characters of the times, hidden digits are replaced by spaces
+#define DISPLAY_LAYOUT_DIGITS "0123456789: "
+
+// All symbols have the same width, but not the same overhang
+#define DISPLAY_LAYOUT_SYMBOL(position, symbols) \
+    displaySlot(position##_X, position##_Y, middle_center, &Antonio_Regular26ptRLE, DISPLAY_SYMBOL_SNOOZE, symbols)
+
+// Centers of the status symbols. With MQTT the WiFi symbol moves up to make room for the MQTT one
+#define DISPLAY_LAYOUT_ALARM_X  35
+#define DISPLAY_LAYOUT_ALARM_Y  205
+#define DISPLAY_LAYOUT_AUDIO_X  35
+#define DISPLAY_LAYOUT_AUDIO_Y  170
+#define DISPLAY_LAYOUT_BED_X    180
+#define DISPLAY_LAYOUT_BED_Y    205
+#define DISPLAY_LAYOUT_SNOOZE_X 175
+#define DISPLAY_LAYOUT_SNOOZE_Y 205
+#define DISPLAY_LAYOUT_COG_X    295
+#define DISPLAY_LAYOUT_COG_Y    170
+#define DISPLAY_LAYOUT_WIFI_X   295
+#ifdef MQTT_ACTIVE
+#define DISPLAY_LAYOUT_WIFI_Y   170
+#else
+#define DISPLAY_LAYOUT_WIFI_Y   205
+#endif
+#define DISPLAY_LAYOUT_MQTT_X   295
+#define DISPLAY_LAYOUT_MQTT_Y   205
+
+constexpr display_slot_t display_layout[DISPLAY_ELEMENTS_NR][DISPLAY_STRINGS_PER_ELEMENT] = {
+    // D_E_TIME: centered, slightly to the right
+    {displaySlot(165, 10, top_center, &Antonio_SemiBold75ptRLE, "00:00", DISPLAY_LAYOUT_DIGITS)},
+    // D_E_ALARM_TIME: symbol and alarm time
+    {DISPLAY_LAYOUT_SYMBOL(DISPLAY_LAYOUT_ALARM, DISPLAY_SYMBOL_ALARM_ON DISPLAY_SYMBOL_ALARM_OFF),
+     displaySlot(100, 200, middle_center, &Antonio_Regular26ptRLE, "00:00", DISPLAY_LAYOUT_DIGITS)},
+    // D_E_ALARM_ACTIVE: replaces the alarm symbol
+    {DISPLAY_LAYOUT_SYMBOL(DISPLAY_LAYOUT_ALARM, DISPLAY_SYMBOL_ALARM_L DISPLAY_SYMBOL_ALARM_R)},
+    // D_E_BED_TIME: symbol and remaining bed time, less than 9 hours
+    {DISPLAY_LAYOUT_SYMBOL(DISPLAY_LAYOUT_BED, DISPLAY_SYMBOL_BED),
+     displaySlot(235, 200, middle_center, &Antonio_Regular26ptRLE, "0:00", DISPLAY_LAYOUT_DIGITS)},
+    // D_E_SNOOZE_TIME: symbol and remaining snooze time
+    {DISPLAY_LAYOUT_SYMBOL(DISPLAY_LAYOUT_SNOOZE, DISPLAY_SYMBOL_SNOOZE),
+     displaySlot(230, 200, middle_center, &Antonio_Regular26ptRLE, "00:00", DISPLAY_LAYOUT_DIGITS)},
+    // D_E_SNOOZE_CANCEL: only bars, see the DISPLAY_LAYOUT_BAR_ defines
+    {},
+    // D_E_WIFI_STATUS
+    {DISPLAY_LAYOUT_SYMBOL(DISPLAY_LAYOUT_WIFI, DISPLAY_SYMBOL_WIFI_ON DISPLAY_SYMBOL_WIFI_OFF)},
+    // D_E_MQTT_STATUS
+#ifdef MQTT_ACTIVE
+    {DISPLAY_LAYOUT_SYMBOL(DISPLAY_LAYOUT_MQTT, DISPLAY_SYMBOL_MQTT_ON DISPLAY_SYMBOL_MQTT_OFF)},
+#else
+    {},
+#endif
+    // D_E_WIFI_SETTING: cog symbol and instructions
+    {DISPLAY_LAYOUT_SYMBOL(DISPLAY_LAYOUT_COG, DISPLAY_SYMBOL_WIFI_COG),
+     displaySlot(220, 175, middle_center, &Antonio_Light16ptRLE, "PRESS", "PRESS"),
+     displaySlot(220, 210, middle_center, &Antonio_Light16ptRLE, "WPS", "WPS")},
+    // D_E_AUDIO
+    {DISPLAY_LAYOUT_SYMBOL(DISPLAY_LAYOUT_AUDIO, DISPLAY_SYMBOL_AUDIO_OFF)},
+};
+
+// Snooze cancel bars
+#define DISPLAY_LAYOUT_BAR_Y    160
+#define DISPLAY_LAYOUT_BAR_H    5
+#define DISPLAY_LAYOUT_BAR_1_X  160
+#define DISPLAY_LAYOUT_BAR_2_X  200
+#define DISPLAY_LAYOUT_BAR_W    35
+
+// Analog face, in the time row instead of the digits. Positions on the dial are 0 to 59, clockwise from 12
+#define DISPLAY_LAYOUT_DIAL_X       160
+#define DISPLAY_LAYOUT_DIAL_Y       72
+#define DISPLAY_LAYOUT_DIAL_R       68  // Nothing of the face reaches beyond this radius
+#define DISPLAY_LAYOUT_DIAL_CAP_R   5   // Cap on the axis of the hands
+#define DISPLAY_LAYOUT_DIAL_TICKS   12
+
+// Radii in pixels, half widths in 1/16 pixels
+constexpr display_dial_shape_t display_dial_hour_hand = {-8, 38, 56, 20};
+constexpr display_dial_shape_t display_dial_minute_hand = {-10, 60, 40, 12};
+constexpr display_dial_shape_t display_dial_tick = {58, 66, 12, 12};
+constexpr display_dial_shape_t display_dial_quarter_tick = {50, 66, 24, 24};
+
+// sin() of the positions of the first quadrant in 1/16384, the other quadrants are mirrored
+constexpr int16_t display_dial_sin[16] = {
+    0, 1713, 3406, 5063, 6664, 8192, 9630, 10963, 12176, 13255, 14189, 14968, 15582, 16026, 16294, 16384,
+};
+
+constexpr int32_t displayDialSin(uint8_t position) {
+    position %= 60;
+    if (position <= 15)
+        return display_dial_sin[position];
+    if (position <= 30)
+        return display_dial_sin[30 - position];
+    if (position <= 45)
+        return -display_dial_sin[position - 30];
+    return -display_dial_sin[60 - position];
+}
+
+constexpr int32_t displayDialCos(uint8_t position) {
+    return displayDialSin(position + 15);
+}
+
+constexpr bool displayDialFits(const display_dial_shape_t *shape) {
+    return -shape->inner < DISPLAY_LAYOUT_DIAL_R && shape->outer + 1 < DISPLAY_LAYOUT_DIAL_R;
+}
+static_assert(displayDialFits(&display_dial_hour_hand) && displayDialFits(&display_dial_minute_hand) &&
+              displayDialFits(&display_dial_tick) && displayDialFits(&display_dial_quarter_tick),
+              "A hand or tick reaches beyond the dial");
+static_assert(DISPLAY_LAYOUT_DIAL_Y - DISPLAY_LAYOUT_DIAL_R >= 0 &&
+              DISPLAY_LAYOUT_DIAL_Y + DISPLAY_LAYOUT_DIAL_R < DISPLAY_STATUS_ROW_Y,
+              "The dial has to fit into the time row");
+
+// Every slot has to fit into a single region, otherwise a part of it would never be flushed
+constexpr bool displayLayoutFitsRegions(void) {
+    for (uint8_t e = 0; e < DISPLAY_ELEMENTS_NR; e++) {
+        for (uint8_t i = 0; i < DISPLAY_STRINGS_PER_ELEMENT; i++) {
+            const display_slot_t *slot = &display_layout[e][i];
+            if (slot->font == NULL)
+                continue;
+            bool time_row = slot->box_y + slot->box_h <= DISPLAY_STATUS_ROW_Y;
+            bool status_row = slot->box_y >= DISPLAY_STATUS_ROW_Y;
+            if (!time_row && !status_row)
+                return false;
+        }
+    }
+    return true;
+}
+static_assert(displayLayoutFitsRegions(), "A layout slot crosses the border between the time and the status row");
+
+#endif // _INCLUDE_DISPLAY_LAYOUT_HPP
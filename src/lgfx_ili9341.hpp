@@ -10,7 +10,6 @@ class LGFX_ILI9341 : public lgfx::LGFX_Device
 {
     lgfx::Panel_ILI9341 _panel_instance;
     lgfx::Bus_SPI _bus_instance;
-    lgfx::Light_PWM _light_instance;
 
 public:
     LGFX_ILI9341(void)
@@ -24,7 +23,7 @@ public:
             cfg.freq_read = 16000000;
             cfg.spi_3wire = false;
             cfg.use_lock = true;                    // Transaction lock
-            cfg.dma_channel = 0;                    // Set the DMA channel (1 or 2. 0=disable)
+            cfg.dma_channel = SPI_DMA_CH_AUTO;      // Set the DMA channel (1 or 2. 0=disable, SPI_DMA_CH_AUTO=automatic)
             cfg.pin_sclk = DISPLAY_SCLK_GPIO;
             cfg.pin_mosi = DISPLAY_MOSI_GPIO;
             cfg.pin_miso = -1;                      // (-1 = disable)
@@ -56,17 +55,6 @@ public:
 
             _panel_instance.config(cfg);
         }
-        {
-            auto cfg = _light_instance.config();
-
-            cfg.pin_bl = DISPLAY_BL_GPIO;
-            cfg.invert = false;         // True if you want to invert the brightness of the backlight
-            cfg.freq = 44100;           // Backlight PWM frequency
-            cfg.pwm_channel = 0;
-
-            _light_instance.config(cfg);
-            _panel_instance.setLight(&_light_instance);
-        }
         setPanel(&_panel_instance);
     }
 };
@@ -6,6 +6,7 @@
 #include "clock_machine.hpp"
 #include "clock_machine_states.hpp"
 #include "clock_common.hpp"
+#include "serial_console.hpp"
 
 extern "C" void app_main() {
     // Initialize NVS (needs to be done first thing in main!)
@@ -18,30 +19,22 @@ extern "C" void app_main() {
     }
     ESP_ERROR_CHECK(ret);
 
-    // Initialise the rotary encoder device with the GPIOs for A and B signals
     RotaryEncoder encoder;
-    QueueHandle_t event_queue = encoder.init(ROT_ENC_A_GPIO, ROT_ENC_B_GPIO, ROT_ENC_BUTTON_GPIO, ROT_ENC_BUTTON_INVERTED);
-
     ClockMachine machine(&encoder);  // By default a clock machine starts in state "TIME"
-    rotary_encoder_event_t event;
 
+    // Initialise the rotary encoder device with the GPIOs for A and B signals. The clock machine has already set itself
+    // as receiver of the events, the queue of the encoder is not used
+    encoder.init(ROT_ENC_A_GPIO, ROT_ENC_B_GPIO, ROT_ENC_BUTTON_GPIO, ROT_ENC_BUTTON_INVERTED);
+    clock_event_t event;
+
+    // Commands typed on the serial monitor, e.g. to take a snapshot of the screen
+    SerialConsole console;
+    console.init(machine.getDisplay());
+
+    // Input, timers, time and status changes all arrive as events, there is nothing to do in between
     while (1) {
-        if (xQueueReceive(event_queue, &event, 10 / portTICK_PERIOD_MS) == pdTRUE) {
-            switch (event.type) {
-                case ENCODER_ROTATION:
-                    machine.encoderRotated(event.position, event.direction);
-                    break;
-                case BUTTON_SHORT_PRESS:
-                    machine.buttonShortPressed();
-                    break;
-                case BUTTON_LONG_PRESS:
-                    machine.buttonLongPressed();
-                    break;
-            }
+        if (xQueueReceive(machine.getEventQueue(), &event, portMAX_DELAY) == pdTRUE) {
+            machine.handleEvent(&event);
         }
-
-        // Perform whatever cyclic activities or checks are needed for this state
-        machine.run();
-        vTaskDelay(10 / portTICK_PERIOD_MS);
     }
 }
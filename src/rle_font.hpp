@@ -0,0 +1,52 @@
+#ifndef _INCLUDE_RLE_FONT_HPP
+#define _INCLUDE_RLE_FONT_HPP
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Run-length encoded fonts, generated with fonts/rlefontconvert.cpp. Each glyph is stored as a list of filled
+// rectangles ("spans") covering its foreground pixels, 4 bytes each: x, y, width and height, relative to the top left
+// corner of the glyph bounding box. The background is not stored, the renderer derives it from the spans
+#define RLE_SPAN_SIZE 4
+
+// Same metrics as GFXglyph, only the bitmap offset is replaced by the spans
+typedef struct {
+    uint16_t spanOffset;  // Index of the first span of the glyph
+    uint16_t spanCount;
+    uint8_t width;        // Bounding box
+    uint8_t height;
+    uint8_t xAdvance;
+    int8_t xOffset;       // From the left of the cell to the bounding box
+    int8_t yOffset;       // From the baseline to the bounding box
+} RLEglyph;
+
+typedef struct {
+    const uint8_t *spans;
+    const RLEglyph *glyph;
+    uint16_t first;
+    uint16_t last;
+    uint8_t yAdvance;
+    uint8_t baseline;  // Distance from the top of a text line to the baseline
+    uint8_t height;    // From the highest to the lowest pixel of all glyphs, like fontHeight() for GFX fonts
+} RLEfont;
+
+// constexpr, so that layouts can be computed at compile time (see display_layout.hpp)
+constexpr const RLEglyph *rleGetGlyph(const RLEfont *font, char c) {
+    uint8_t code = (uint8_t)c;
+    if (code < font->first || code > font->last)
+        return NULL;
+    return &font->glyph[code - font->first];
+}
+
+constexpr int32_t rleCharWidth(const RLEfont *font, char c) {
+    const RLEglyph *glyph = rleGetGlyph(font, c);
+    return (glyph == NULL) ? 0 : glyph->xAdvance;
+}
+
+constexpr int32_t rleTextWidth(const RLEfont *font, const char *text) {
+    int32_t width = 0;
+    while (*text) width += rleCharWidth(font, *text++);
+    return width;
+}
+
+#endif // _INCLUDE_RLE_FONT_HPP
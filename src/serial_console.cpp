@@ -0,0 +1,156 @@
+#include "driver/uart.h"
+#include "driver/usb_serial_jtag.h"
+#include "esp_idf_version.h"
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+#include "driver/usb_serial_jtag_vfs.h"
+#else
+#include "esp_vfs_usb_serial_jtag.h"
+#endif
+#include "esp_log.h"
+#include "mbedtls/base64.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <serial_console.hpp>
+
+static const char *TAG = "console";
+
+// CRC-16/CCITT-FALSE of a row, its pixels taken big endian
+static uint16_t rowCRC(const uint16_t *pixels, size_t pixels_nr) {
+    uint16_t crc = 0xFFFF;
+    for (size_t i = 0; i < pixels_nr * 2; i++) {
+        uint8_t byte = (i & 1) ? (pixels[i >> 1] & 0xFF) : (pixels[i >> 1] >> 8);
+        crc ^= byte << 8;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x8000) ? ((crc << 1) ^ 0x1021) : (crc << 1);
+        }
+    }
+    return crc;
+}
+
+void SerialConsole::init(Display *display_ref) {
+    display = display_ref;
+#if CONSOLE_USB_SERIAL_JTAG
+    // Once the driver owns the USB-Serial-JTAG, the console has to write through it as well (as the esp_console REPL
+    // does). The UART part of a secondary console is not affected
+    usb_serial_jtag_driver_config_t config = USB_SERIAL_JTAG_DRIVER_CONFIG_DEFAULT();
+    config.rx_buffer_size = CONSOLE_RX_BUFFER_SIZE;
+    ESP_ERROR_CHECK(usb_serial_jtag_driver_install(&config));
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 3, 0)
+    usb_serial_jtag_vfs_use_driver();
+#else
+    esp_vfs_usb_serial_jtag_use_driver();
+#endif
+    ESP_LOGI(TAG, "Reading commands from the USB-Serial-JTAG");
+#else
+    // Only the receiving side goes through the driver, the logs are written as before
+    ESP_ERROR_CHECK(uart_driver_install(CONSOLE_UART_NUM, CONSOLE_RX_BUFFER_SIZE, 0, 0, NULL, 0));
+    ESP_LOGI(TAG, "Reading commands from UART%d", CONSOLE_UART_NUM);
+#endif
+    xTaskCreate(this->consoleTask, "console_task", CONSOLE_TASK_STACK, this, CONSOLE_TASK_PRIORITY, NULL);
+}
+
+void SerialConsole::consoleTask(void *pvParameter) {
+    SerialConsole *pThis = (SerialConsole *)pvParameter;
+    char command[CONSOLE_COMMAND_MAX];
+    size_t length = 0;
+    while (1) {
+        // Blocks until something is typed, the task costs nothing otherwise
+        uint8_t c;
+        if (pThis->readByte(&c) != 1)
+            continue;
+        if (c == '\r' || c == '\n') {
+            command[length] = '\0';
+            if (length > 0)
+                pThis->handleCommand(command);
+            length = 0;
+        } else if (length < CONSOLE_COMMAND_MAX - 1) {
+            command[length++] = c;
+        }
+    }
+}
+
+int SerialConsole::readByte(uint8_t *c) {
+#if CONSOLE_USB_SERIAL_JTAG
+    return usb_serial_jtag_read_bytes(c, 1, portMAX_DELAY);
+#else
+    return uart_read_bytes(CONSOLE_UART_NUM, c, 1, portMAX_DELAY);
+#endif
+}
+
+void SerialConsole::handleCommand(const char *command) {
+    if (strcmp(command, "snapshot") == 0) {
+        sendSnapshot();
+    } else {
+        printf("Unknown command \"%s\", known: snapshot\n", command);
+    }
+}
+
+// Sends what the screen shows, one line per row:
+//   SNAP BEGIN <nr> <width> <height>
+//   SNAP <nr> <y> <CRC-16 of the row> <base64 of the runs, or = if the row is the same as the one before>
+//   SNAP END <nr> <rows>
+// or SNAP FAIL <nr> <reason>. The lines are text, so that they survive between the logs
+void SerialConsole::sendSnapshot(void) {
+    uint16_t nr = snapshot_nr++;
+    char header[64];
+    console_snapshot_t *snapshot = (console_snapshot_t *)malloc(sizeof(console_snapshot_t));
+    if (snapshot == NULL) {
+        sendLine(header, snprintf(header, sizeof(header), "SNAP FAIL %u out of memory\n", nr));
+        return;
+    }
+    ESP_LOGI(TAG, "Sending snapshot %u", nr);
+    sendLine(header, snprintf(header, sizeof(header), "SNAP BEGIN %u %d %d\n", nr, DISPLAY_WIDTH, DISPLAY_HEIGHT));
+
+    for (int32_t y = 0; y < DISPLAY_HEIGHT; y++) {
+        if (!display->readScreenRow(y, snapshot->row)) {
+            sendLine(header, snprintf(header, sizeof(header), "SNAP FAIL %u row %d has no back buffer\n", nr, (int)y));
+            free(snapshot);
+            return;
+        }
+        size_t length = snprintf(snapshot->line, CONSOLE_SNAPSHOT_LINE_MAX, "SNAP %u %d %04X ", nr, (int)y,
+                                 rowCRC(snapshot->row, DISPLAY_WIDTH));
+        if (y > 0 && memcmp(snapshot->row, snapshot->previous_row, sizeof(snapshot->row)) == 0) {
+            // Most rows of the clock are the same as the one above
+            snapshot->line[length++] = '=';
+        } else {
+            size_t encoded;
+            mbedtls_base64_encode((unsigned char *)&snapshot->line[length], CONSOLE_SNAPSHOT_LINE_MAX - length - 1,
+                                  &encoded, snapshot->runs, encodeRow(snapshot));
+            length += encoded;
+        }
+        snapshot->line[length++] = '\n';
+        sendLine(snapshot->line, length);
+        memcpy(snapshot->previous_row, snapshot->row, sizeof(snapshot->row));
+    }
+
+    sendLine(header, snprintf(header, sizeof(header), "SNAP END %u %d\n", nr, DISPLAY_HEIGHT));
+    free(snapshot);
+}
+
+// Run-length encoding of the row: length - 1 and RGB565 big endian of every run of equal pixels
+size_t SerialConsole::encodeRow(console_snapshot_t *snapshot) {
+    size_t bytes = 0;
+    for (int32_t x = 0; x < DISPLAY_WIDTH;) {
+        uint16_t color = snapshot->row[x];
+        int32_t run = 1;
+        while (x + run < DISPLAY_WIDTH && run < CONSOLE_SNAPSHOT_RUN_MAX && snapshot->row[x + run] == color) {
+            run++;
+        }
+        snapshot->runs[bytes++] = run - 1;
+        snapshot->runs[bytes++] = color >> 8;
+        snapshot->runs[bytes++] = color & 0xFF;
+        x += run;
+    }
+    return bytes;
+}
+
+void SerialConsole::sendLine(const char *line, size_t length) {
+    // Writing waits for the UART FIFO or the buffer of the USB-Serial-JTAG driver. Sleeping for the time a UART at
+    // CONSOLE_BAUDRATE needs for the line keeps this task from spinning on it, a snapshot takes a few seconds in the
+    // background
+    fwrite(line, 1, length, stdout);
+    fflush(stdout);
+    vTaskDelay(std::max<TickType_t>(pdMS_TO_TICKS((length * 10 * 1000) / CONSOLE_BAUDRATE), 1));
+}
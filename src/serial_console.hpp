@@ -0,0 +1,55 @@
+#ifndef _INCLUDE_SERIAL_CONSOLE_HPP_
+#define _INCLUDE_SERIAL_CONSOLE_HPP_
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "sdkconfig.h"
+#include <display.hpp>
+
+// The USB-C port of the XIAO ESP32-C3 is the USB-Serial-JTAG, as primary or as secondary console. The secondary
+// console only writes, so the commands are read through the driver of the USB-Serial-JTAG then. The UART of the
+// console is only read if there is no USB-Serial-JTAG console (on the XIAO its pins belong to the DFPlayer)
+#if CONFIG_ESP_CONSOLE_USB_SERIAL_JTAG || CONFIG_ESP_CONSOLE_SECONDARY_USB_SERIAL_JTAG
+#define CONSOLE_USB_SERIAL_JTAG     1
+#define CONSOLE_BAUDRATE            115200  // Paces the lines of a snapshot, USB itself is faster
+#else
+#define CONSOLE_USB_SERIAL_JTAG     0
+#define CONSOLE_UART_NUM            CONFIG_ESP_CONSOLE_UART_NUM
+#define CONSOLE_BAUDRATE            CONFIG_ESP_CONSOLE_UART_BAUDRATE
+#endif
+#define CONSOLE_RX_BUFFER_SIZE      256   // Has to be larger than the UART FIFO
+#define CONSOLE_COMMAND_MAX         32
+#define CONSOLE_TASK_STACK          3072
+#define CONSOLE_TASK_PRIORITY       tskIDLE_PRIORITY  // Everything else goes first
+#define CONSOLE_SNAPSHOT_RUN_MAX    256   // Pixels per run of the row encoding
+#define CONSOLE_SNAPSHOT_RUN_BYTES  3     // Length - 1, RGB565 big endian
+// Worst case of a row: every pixel is a run of its own, base64 encoded
+#define CONSOLE_SNAPSHOT_ROW_BYTES  (DISPLAY_WIDTH * CONSOLE_SNAPSHOT_RUN_BYTES)
+#define CONSOLE_SNAPSHOT_LINE_MAX   (((CONSOLE_SNAPSHOT_ROW_BYTES + 2) / 3) * 4 + 32)
+
+// Buffers of a snapshot, only allocated while it is sent
+typedef struct {
+    uint16_t row[DISPLAY_WIDTH];
+    uint16_t previous_row[DISPLAY_WIDTH];
+    uint8_t runs[CONSOLE_SNAPSHOT_ROW_BYTES];
+    char line[CONSOLE_SNAPSHOT_LINE_MAX];
+} console_snapshot_t;
+
+// Commands typed on the serial console (the USB-Serial-JTAG or the UART of the monitor), e.g. "snapshot" to send what the screen shows. See
+// tools/snapshot for the format and the tool which turns it into an image again
+class SerialConsole {
+    Display *display;
+    uint16_t snapshot_nr = 0;
+
+    static void consoleTask(void *pvParameter);
+    int readByte(uint8_t *c);
+    void handleCommand(const char *command);
+    void sendSnapshot(void);
+    size_t encodeRow(console_snapshot_t *snapshot);
+    void sendLine(const char *line, size_t length);
+
+   public:
+    void init(Display *display_ref);
+};
+
+#endif // _INCLUDE_SERIAL_CONSOLE_HPP_
@@ -9,6 +9,9 @@ static bool mqtt_is_initialized = false;
 static bool mqtt_is_connected = false;
 #endif
 
+// The SNTP callback has no argument to pass the instance
+static WifiTime *sntp_instance = NULL;
+
 void WifiTime::wifiEventHandler(void *pvParameter, esp_event_base_t event_base, int32_t event_id, void *event_data) {
     WifiTime *pThis = (WifiTime *)pvParameter;
     if (event_base == WIFI_EVENT) {
@@ -17,7 +20,10 @@ void WifiTime::wifiEventHandler(void *pvParameter, esp_event_base_t event_base,
                 esp_wifi_connect();
                 break;
             case WIFI_EVENT_STA_DISCONNECTED:
-                pThis->wifi_is_connected = false;
+                if (pThis->wifi_is_connected) {
+                    pThis->wifi_is_connected = false;
+                    pThis->postEvent(CLOCK_EVENT_WIFI_STATUS);
+                }
                 if (pThis->retry_num < WIFI_NR_RETRIES) {
                     esp_wifi_connect();
                     pThis->retry_num++;
@@ -68,6 +74,7 @@ void WifiTime::monitorWifi(void) {
     if (bits & WIFI_CONNECTED_BIT) {
         ESP_LOGI(TAG, "Connected to WiFi: %s", wifi_credentials->ssid);
         wifi_is_connected = true;
+        postEvent(CLOCK_EVENT_WIFI_STATUS);
         #ifdef MQTT_ACTIVE
         if (!mqtt_is_initialized)
             mqttAppStart();
@@ -139,7 +146,22 @@ bool WifiTime::isWPSActive(void) {
     return wps_is_active;
 }
 
+void WifiTime::postEvent(clock_event_type_t type) {
+    clock_event_t event = {};
+    event.type = type;
+    if (xQueueSend(event_queue, &event, 0) != pdTRUE)
+        dropped_events++;
+}
+
+void WifiTime::timeSyncNotification(struct timeval *tv) {
+    ESP_LOGI(TAG, "Time synchronised");
+    if (sntp_instance != NULL)
+        sntp_instance->postEvent(CLOCK_EVENT_TIME_SET);
+}
+
 void WifiTime::initSNTP(void) {
+    sntp_instance = this;
+    sntp_set_time_sync_notification_cb(timeSyncNotification);
     sntp_setoperatingmode(SNTP_OPMODE_POLL);
     sntp_setservername(0, "pool.ntp.org");
     sntp_set_sync_mode(SNTP_SYNC_MODE_SMOOTH);
@@ -149,8 +171,9 @@ void WifiTime::initSNTP(void) {
     tzset();
 }
 
-void WifiTime::init(wifi_credentials_t *credentials) {
+void WifiTime::init(wifi_credentials_t *credentials, QueueHandle_t clock_event_queue) {
     wifi_credentials = credentials;
+    event_queue = clock_event_queue;
     sntp_servermode_dhcp(0);
     initSTA();
     initSNTP();
@@ -194,23 +217,26 @@ void WifiTime::mqttAppStart(void) {
     mqttConfig.credentials.authentication.password = MQTT_PASSWORD;
 
     mqtt_client = esp_mqtt_client_init(&mqttConfig);
-    ESP_ERROR_CHECK(esp_mqtt_client_register_event(mqtt_client, MQTT_EVENT_ERROR, mqttEventHandler, NULL));
-	ESP_ERROR_CHECK(esp_mqtt_client_register_event(mqtt_client, MQTT_EVENT_CONNECTED, mqttEventHandler, NULL));
-	ESP_ERROR_CHECK(esp_mqtt_client_register_event(mqtt_client, MQTT_EVENT_DISCONNECTED, mqttEventHandler, NULL));
+    ESP_ERROR_CHECK(esp_mqtt_client_register_event(mqtt_client, MQTT_EVENT_ERROR, mqttEventHandler, this));
+	ESP_ERROR_CHECK(esp_mqtt_client_register_event(mqtt_client, MQTT_EVENT_CONNECTED, mqttEventHandler, this));
+	ESP_ERROR_CHECK(esp_mqtt_client_register_event(mqtt_client, MQTT_EVENT_DISCONNECTED, mqttEventHandler, this));
     ESP_ERROR_CHECK(esp_mqtt_client_start(mqtt_client));
 }
 
 void WifiTime::mqttEventHandler(void *arg, esp_event_base_t base, int32_t event_id, void *event_data) {
+    WifiTime *pThis = (WifiTime *)arg;
     esp_mqtt_event_handle_t event = (esp_mqtt_event_handle_t)event_data;
     switch ((esp_mqtt_event_id_t)event_id) {
         case MQTT_EVENT_CONNECTED:
             ESP_LOGI(TAG, "MQTT is connected");				
             mqtt_is_connected = true;
             mqtt_is_initialized = true;
+            pThis->postEvent(CLOCK_EVENT_MQTT_STATUS);
             break;
         case MQTT_EVENT_DISCONNECTED:
             ESP_LOGE(TAG, "MQTT is disconnected");		
             mqtt_is_connected = false;
+            pThis->postEvent(CLOCK_EVENT_MQTT_STATUS);
             break;
         case MQTT_EVENT_ERROR:
             ESP_LOGE(TAG, "MQTT_EVENT_ERROR has been reported");
@@ -1,12 +1,14 @@
 #ifndef _INCLUDE_WIFI_TIME_HPP_
 #define _INCLUDE_WIFI_TIME_HPP_
 
+#include <atomic>
 #include "freertos/FreeRTOS.h"
 #include "freertos/event_groups.h"
+#include "freertos/queue.h"
 #include "esp_wifi.h"
 #include "esp_wps.h"
 #include "esp_sntp.h"
-#include "clock_common.hpp"
+#include "clock_events.hpp"
 #include "mqtt_config.hpp"
 #ifdef MQTT_ACTIVE
 #include "mqtt_client.h"
@@ -26,6 +28,8 @@ class WifiTime {
     void monitorWifi(void);
     void initSTA(void);
     void initSNTP(void);
+    static void timeSyncNotification(struct timeval *tv);
+    void postEvent(clock_event_type_t type);
     #ifdef MQTT_ACTIVE
     void mqttAppStart(void);
     static void mqttEventHandler(void *arg, esp_event_base_t base, int32_t event_id, void *event_data);
@@ -36,12 +40,14 @@ class WifiTime {
     uint8_t retry_num = 0;
     bool wps_is_active = false;
     wifi_credentials_t *wifi_credentials;
+    QueueHandle_t event_queue;
+    std::atomic<uint32_t> dropped_events{0};  // Posted from the event loop and the SNTP callback
     #ifdef MQTT_ACTIVE
     esp_mqtt_client_handle_t mqtt_client = NULL;
     #endif
 
    public:
-    void init(wifi_credentials_t *credentials);
+    void init(wifi_credentials_t *credentials, QueueHandle_t clock_event_queue);
     void startWPS(void);
     void stopWPS(void);
     bool isWPSActive(void);
@@ -49,6 +55,7 @@ class WifiTime {
     bool isWifiConnected(void);
     void setTime(struct tm *timeinfo);
     void getTime(clock_time_t *time);
+    uint32_t getDroppedEvents(void) { return dropped_events; }
     #ifdef MQTT_ACTIVE
     bool isMQTTConnected(void);
     void sendMQTTAlarmTriggered(void);
@@ -0,0 +1,485 @@
+// Runs ClockMachine and all its states on a virtual clock (see README.md): scripted input scenarios, then a day by day
+// replay of a whole year with an alarm every morning
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <chrono>
+#include "clock_machine.hpp"
+#include "host_sim.hpp"
+
+#define SIM_DAY_S           (24 * 60 * 60)
+#define SIM_INPUT_GAP_MS    200   // Between two inputs of a sequence
+#define SIM_SNOOZE_CHECKS   3
+
+static RotaryEncoder *encoder;
+static ClockMachine *machine;
+static const char *scenario = "";
+static uint32_t checks = 0;
+static uint32_t failures = 0;
+static uint64_t events_handled = 0;
+static uint32_t outside_frame_at_boot;
+
+static void check(bool ok, const char *format, ...) {
+    checks++;
+    if (ok)
+        return;
+    failures++;
+    time_t now = host_wall_clock();
+    struct tm timeinfo;
+    char date[32];
+    localtime_r(&now, &timeinfo);
+    strftime(date, sizeof(date), "%Y-%m-%d %H:%M:%S", &timeinfo);
+    printf("FAIL %s at %s: ", scenario, date);
+    va_list args;
+    va_start(args, format);
+    vprintf(format, args);
+    va_end(args);
+    printf("\n");
+}
+
+// Hands all queued events to the machine, as the main loop does
+static void drain(void) {
+    clock_event_t event;
+    while (xQueueReceive(machine->getEventQueue(), &event, 0) == pdTRUE) {
+        machine->handleEvent(&event);
+        events_handled++;
+    }
+}
+
+static void runFor(int64_t duration_us) {
+    int64_t until_us = esp_timer_get_time() + duration_us;
+    drain();
+    while (host_run_next_timer(until_us))
+        drain();
+}
+
+static int64_t wallClockUs(void) {
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    return (int64_t)now.tv_sec * 1000000 + now.tv_usec;
+}
+
+static void runUntil(time_t wall_clock) {
+    runFor((int64_t)wall_clock * 1000000 - wallClockUs());
+}
+
+static void rotate(rotary_encoder_dir_t direction, int detents) {
+    for (int i = 0; i < detents; i++) {
+        encoder->simRotate(direction);
+        runFor(SIM_INPUT_GAP_MS * 1000);
+    }
+}
+
+static void press(bool long_press) {
+    if (long_press)
+        runFor(LONG_PRESS_DURATION * 1000);  // Held down
+    encoder->simPress(long_press);
+    runFor(SIM_INPUT_GAP_MS * 1000);
+}
+
+// Epoch of a local time of the clock
+static time_t localTime(int year, int month, int day, int hour, int minute, int second) {
+    struct tm timeinfo = {};
+    timeinfo.tm_year = year - 1900;
+    timeinfo.tm_mon = month - 1;
+    timeinfo.tm_mday = day;
+    timeinfo.tm_hour = hour;
+    timeinfo.tm_min = minute;
+    timeinfo.tm_sec = second;
+    timeinfo.tm_isdst = -1;
+    return mktime(&timeinfo);
+}
+
+// Starts a new clock with empty NVS, before SNTP, and synchronises it to now
+static void boot(time_t now) {
+    host_reset();
+    encoder = new RotaryEncoder();
+    machine = new ClockMachine(encoder);  // Never deleted, the clock has no destructor
+    encoder->init(ROT_ENC_A_GPIO, ROT_ENC_B_GPIO, ROT_ENC_BUTTON_GPIO, ROT_ENC_BUTTON_INVERTED);
+    drain();
+    outside_frame_at_boot = machine->getDisplay()->outside_frame;
+    machine->getWifiTime()->simSyncTime(now);
+    drain();
+}
+
+static bool shows(display_element_t element, display_action_t action) {
+    return machine->getDisplay()->shown[element].action == action;
+}
+
+static bool showsTime(display_element_t element, uint8_t hour, uint8_t minute) {
+    const display_command_t *command = &machine->getDisplay()->shown[element];
+    return command->value_valid && command->value.time.hour == hour && command->value.time.minute == minute;
+}
+
+static bool isRinging(void) {
+    DFPlayer *player = machine->getPlayer();
+    return player->looping && player->track == machine->settings.melody_nr;
+}
+
+// Snooze, first rotation, long press and a rotation the other way
+static void cancelAlarm(void) {
+    press(false);
+    rotate(DIR_RIGHT, 1);
+    press(true);
+    rotate(DIR_LEFT, 1);
+}
+
+//-------------//
+//  SCENARIOS  //
+//-------------//
+
+static void scenarioSetAlarm(void) {
+    scenario = "set_alarm";
+    Display *display = machine->getDisplay();
+    press(true);
+    check(shows(D_E_ALARM_TIME, D_A_HIDE_HOURS) || shows(D_E_ALARM_TIME, D_A_ON), "alarm time not shown");
+
+    uint32_t blinks = display->updates[D_E_ALARM_TIME];
+    runFor(2000000);
+    blinks = display->updates[D_E_ALARM_TIME] - blinks;
+    check(blinks == 2000 / BLINK_PERIOD_MS, "%u blinks of the hours in 2 s", blinks);
+
+    rotate(DIR_LEFT, 1);
+    check(showsTime(D_E_ALARM_TIME, 6, 0), "hours not set to 6");
+    press(false);
+    rotate(DIR_LEFT, 5);
+    check(showsTime(D_E_ALARM_TIME, 6, 55), "minutes not set to 55");
+    press(false);
+
+    check(machine->is_alarm_set, "alarm not set");
+    check(shows(D_E_ALARM_TIME, D_A_ON) && showsTime(D_E_ALARM_TIME, 6, 55), "alarm time not shown as set");
+    check(showsTime(D_E_BED_TIME, 0, 5), "bed time %02u:%02u instead of 00:05",
+          display->shown[D_E_BED_TIME].value.time.hour, display->shown[D_E_BED_TIME].value.time.minute);
+    check(display->increased_brightness, "no increased brightness after setting");
+    runFor((BRIGHTNESS_BOOST_MS + SIM_INPUT_GAP_MS) * 1000);
+    check(!display->increased_brightness, "increased brightness not over");
+
+    // Blinking stopped with the state
+    blinks = display->updates[D_E_ALARM_TIME];
+    runFor(2000000);
+    check(display->updates[D_E_ALARM_TIME] == blinks, "alarm time still blinking");
+}
+
+static void scenarioTrigger(time_t alarm) {
+    scenario = "trigger";
+    Display *display = machine->getDisplay();
+    DFPlayer *player = machine->getPlayer();
+    runUntil(alarm - 1);
+    check(!isRinging(), "ringing before the alarm time");
+    runUntil(alarm + 1);
+    check(isRinging(), "not ringing at the alarm time");
+    check(display->max_brightness, "no maximum brightness");
+
+    // One volume step every crescendo_factor blink periods, starting at 5
+    int volume = player->volume;
+    runFor(30000000);
+    int steps = 30000 / (BLINK_PERIOD_MS * machine->settings.crescendo_factor);
+    check(player->volume == volume + steps, "volume %d after 30 s instead of %d", player->volume, volume + steps);
+    check(display->updates[D_E_ALARM_ACTIVE] >= 60, "alarm symbol not blinking");
+}
+
+static void scenarioSnooze(void) {
+    scenario = "snooze";
+    Display *display = machine->getDisplay();
+    for (int i = 0; i < SIM_SNOOZE_CHECKS; i++) {
+        press(false);
+        check(!isRinging(), "still ringing after snooze %d", i + 1);
+        check(!display->max_brightness, "maximum brightness after snooze %d", i + 1);
+
+        uint32_t ticks = display->updates[D_E_SNOOZE_TIME];
+        runFor((int64_t)machine->settings.snooze_time_s * 1000000 - SIM_INPUT_GAP_MS * 1000 - 500000);
+        check(!isRinging(), "ringing before the end of snooze %d", i + 1);
+        check(display->shown[D_E_SNOOZE_TIME].value.seconds == 1, "snooze %d shows %u s before its end", i + 1,
+              display->shown[D_E_SNOOZE_TIME].value.seconds);
+        runFor(1000000);
+        check(isRinging(), "not ringing after snooze %d", i + 1);
+        ticks = display->updates[D_E_SNOOZE_TIME] - ticks;
+        // Every second but the last one, plus the removal of the countdown
+        check(ticks == machine->settings.snooze_time_s, "%u snooze time updates in snooze %d", ticks, i + 1);
+        check(shows(D_E_SNOOZE_TIME, D_A_OFF), "snooze time shown while ringing");
+    }
+}
+
+static void scenarioCancel(void) {
+    scenario = "cancel";
+    Display *display = machine->getDisplay();
+    DFPlayer *player = machine->getPlayer();
+    cancelAlarm();
+    check(!isRinging(), "ringing after cancelling");
+    check(!machine->is_alarm_set, "alarm still set");
+    check(shows(D_E_ALARM_TIME, D_A_OFF), "alarm time still shown");
+    check(shows(D_E_SNOOZE_CANCEL, D_A_OFF), "cancel bars still shown");
+    #ifdef MQTT_ACTIVE
+    WifiTime *wifi_time = machine->getWifiTime();
+    check(wifi_time->mqtt_alarms_triggered == 1 + SIM_SNOOZE_CHECKS, "%u alarms sent over MQTT",
+          wifi_time->mqtt_alarms_triggered);
+    check(wifi_time->mqtt_alarms_stopped == 1, "%u stopped alarms sent over MQTT", wifi_time->mqtt_alarms_stopped);
+    #endif
+
+    uint32_t started = player->started;
+    runFor(600000000);
+    check(player->started == started, "player started after cancelling");
+    check(display->frames > 0 && display->outside_frame == outside_frame_at_boot, "%u updates outside of a frame",
+          display->outside_frame - outside_frame_at_boot);
+}
+
+static void scenarioCancelWindow(time_t alarm) {
+    scenario = "cancel_window";
+    press(false);
+    check(machine->is_alarm_set, "alarm not set again");
+    runUntil(alarm + 1);
+    check(isRinging(), "not ringing the next day");
+    press(false);
+
+    // The window of the first step runs out, the long press starts nothing
+    rotate(DIR_RIGHT, 1);
+    check(shows(D_E_SNOOZE_CANCEL, D_A_ONE_BAR), "no bar after the first rotation");
+    runFor(CANCEL_WINDOW_MS * 1000);
+    check(shows(D_E_SNOOZE_CANCEL, D_A_OFF), "bar still shown after the window");
+    press(true);
+    check(shows(D_E_SNOOZE_CANCEL, D_A_OFF), "bars shown after a late long press");
+    rotate(DIR_LEFT, 1);
+    check(machine->is_alarm_set && shows(D_E_SNOOZE_CANCEL, D_A_ONE_BAR), "cancelled without a complete sequence");
+
+    // Completed from there, within the windows. Any press in between keeps the window of the step alive
+    runFor(CANCEL_WINDOW_MS * 1000 / 2);
+    press(false);
+    runFor(CANCEL_WINDOW_MS * 1000 / 2);
+    check(shows(D_E_SNOOZE_CANCEL, D_A_ONE_BAR), "window of the first step not extended by a short press");
+    press(true);
+    check(shows(D_E_SNOOZE_CANCEL, D_A_TWO_BARS), "no second bar after the long press");
+    runFor(CANCEL_WINDOW_MS * 1000 / 2);
+    press(false);
+    runFor(CANCEL_WINDOW_MS * 1000 / 2);
+    check(shows(D_E_SNOOZE_CANCEL, D_A_TWO_BARS), "window of the second step not extended by a short press");
+    rotate(DIR_RIGHT, 1);
+    check(!machine->is_alarm_set && !isRinging(), "not cancelled by the complete sequence");
+}
+
+static void scenarioTimeStep(time_t alarm) {
+    scenario = "time_step";
+    // SNTP corrects the clock by more than an hour, the time follows at once and the minute timer with it
+    time_t now = host_wall_clock() + 3725;
+    machine->getWifiTime()->simSyncTime(now);
+    drain();
+    struct tm timeinfo;
+    localtime_r(&now, &timeinfo);
+    check(showsTime(D_E_TIME, timeinfo.tm_hour, timeinfo.tm_min), "time not updated after the step");
+    uint32_t updates = machine->getDisplay()->updates[D_E_TIME];
+    runFor(10 * 60 * 1000000LL);
+    updates = machine->getDisplay()->updates[D_E_TIME] - updates;
+    check(updates == 10, "%u time updates in 10 minutes after the step", updates);
+
+    // The time steps across an armed alarm, it rings right away
+    press(false);
+    check(machine->is_alarm_set, "alarm not set for the step");
+    runUntil(alarm - 300);
+    machine->getWifiTime()->simSyncTime(alarm + 60);
+    drain();
+    check(isRinging(), "not ringing after a step across the alarm");
+    cancelAlarm();
+
+    // Set again, a step back across the alarm time does not ring it again
+    press(false);
+    machine->getWifiTime()->simSyncTime(alarm - 60);
+    runUntil(alarm + 60);
+    check(!isRinging(), "ringing again after a step back");
+}
+
+// The alarm falls due while the clock is in another state, it rings when the clock is back in the time state
+static void scenarioAlarmPending(time_t wps_alarm, time_t set_alarm) {
+    scenario = "alarm_pending";
+    WifiTime *wifi_time = machine->getWifiTime();
+    check(machine->is_alarm_set, "alarm not set");
+
+    runUntil(wps_alarm - 60);
+    wifi_time->simSetWifiConnected(false);
+    rotate(DIR_RIGHT, 1);
+    check(wifi_time->isWPSActive(), "WPS not started");
+    runUntil(wps_alarm + 120);
+    check(!isRinging(), "ringing during WPS");
+    wifi_time->simSetWifiConnected(true);
+    drain();
+    check(isRinging(), "not ringing after WPS");
+    cancelAlarm();
+    press(false);
+
+    // Left unchanged in the alarm setting
+    runUntil(set_alarm - 30);
+    press(true);
+    runUntil(set_alarm + 30);
+    check(!isRinging(), "ringing while setting the alarm");
+    press(false);
+    press(false);
+    check(isRinging(), "not ringing after setting the same alarm time");
+    cancelAlarm();
+}
+
+// The player stops answering and comes back, the audio symbol follows without any other event
+static void scenarioAudioStatus(void) {
+    scenario = "audio_status";
+    DFPlayer *player = machine->getPlayer();
+    check(shows(D_E_AUDIO, D_A_ON), "audio symbol off with the player online");
+    player->simSetOnline(false);
+    drain();
+    check(shows(D_E_AUDIO, D_A_OFF), "audio symbol on with the player offline");
+    player->simSetOnline(true);
+    drain();
+    check(shows(D_E_AUDIO, D_A_ON), "audio symbol off with the player back");
+}
+
+//------------//
+//  YEAR RUN  //
+//------------//
+
+// Every day: an alarm at 07:00, snoozed once and cancelled, then set again right away. Every minute of the day has to
+// be shown
+static void runDays(int year, int days) {
+    scenario = "days";
+    Display *display = machine->getDisplay();
+    display->record_commands = true;
+    press(false);  // Default alarm time, 07:00
+    check(machine->is_alarm_set && showsTime(D_E_ALARM_TIME, 7, 0), "default alarm not set");
+
+    clock_time_t shown_time = display->shown[D_E_TIME].value.time;
+    for (int day = 0; day < days; day++) {
+        time_t day_start = localTime(year, 1, 1 + day, 0, 0, 0);
+        time_t day_end = localTime(year, 1, 2 + day, 0, 0, 0);
+        time_t alarm = localTime(year, 1, 1 + day, 7, 0, 0);
+        int64_t wall_offset_us = wallClockUs() - esp_timer_get_time();
+        display->commands.clear();
+
+        runUntil(alarm - 1);
+        check(!isRinging(), "ringing before the alarm");
+        runUntil(alarm + 1);
+        check(isRinging(), "not ringing at the alarm time");
+        press(false);
+        runFor(30000000);
+        cancelAlarm();
+        check(!isRinging() && !machine->is_alarm_set, "alarm not cancelled");
+
+        // Set again within the alarm minute, the next alarm is tomorrow's. The bed time is the real time left
+        press(false);
+        check(machine->is_alarm_set && !isRinging(), "alarm not set again for tomorrow");
+        time_t now = host_wall_clock();
+        uint32_t bed_minutes = (uint32_t)((localTime(year, 1, 2 + day, 7, 0, 0) - (now - now % 60)) / 60);
+        check(showsTime(D_E_BED_TIME, bed_minutes / 60, bed_minutes % 60), "bed time %02u:%02u instead of %02u:%02u",
+              display->shown[D_E_BED_TIME].value.time.hour, display->shown[D_E_BED_TIME].value.time.minute,
+              bed_minutes / 60, bed_minutes % 60);
+        runUntil(day_end + 1);
+
+        // Entering the time state shows the time again, only changes count
+        uint32_t minutes = 0;
+        for (const display_command_t &command : display->commands) {
+            if (command.element != D_E_TIME)
+                continue;
+            bool changed = (command.value.time.hour != shown_time.hour) || (command.value.time.minute != shown_time.minute);
+            shown_time = command.value.time;
+            time_t shown_at = (time_t)((wall_offset_us + command.time_us) / 1000000);
+            struct tm timeinfo;
+            localtime_r(&shown_at, &timeinfo);
+            if (command.value.time.hour != timeinfo.tm_hour || command.value.time.minute != timeinfo.tm_min) {
+                check(false, "%02u:%02u shown at %02d:%02d:%02d", command.value.time.hour, command.value.time.minute,
+                      timeinfo.tm_hour, timeinfo.tm_min, timeinfo.tm_sec);
+                break;
+            }
+            if (changed)
+                minutes++;
+        }
+        // Midnight is shown as part of the previous day. 23 and 25 hours on the days the clocks change
+        uint32_t expected = (uint32_t)((day_end - day_start) / 60);
+        check(minutes == expected, "%u minutes shown on day %d instead of %u", minutes, day + 1, expected);
+    }
+    display->commands.clear();
+}
+
+// One line per scenario, with the checks since the last one
+static void report(void) {
+    // The main loop keeps up with every scenario, nothing may be lost
+    check(machine->getDroppedEvents() == 0, "%u events dropped", machine->getDroppedEvents());
+    static uint32_t reported_checks = 0;
+    static uint32_t reported_failures = 0;
+    printf("%-14s %7u %7u %12lld\n", scenario, checks - reported_checks, failures - reported_failures,
+           (long long)(esp_timer_get_time() / 1000000));
+    reported_checks = checks;
+    reported_failures = failures;
+}
+
+static void usage(const char *name) {
+    fprintf(stderr, "Usage: %s [-d days] [-y year] [-v]\n", name);
+    exit(2);
+}
+
+int main(int argc, char *argv[]) {
+    int days = 365;
+    int year = 2026;
+    int opt;
+    while ((opt = getopt(argc, argv, "d:y:v")) != -1) {
+        switch (opt) {
+            case 'd':
+                days = atoi(optarg);
+                break;
+            case 'y':
+                year = atoi(optarg);
+                break;
+            case 'v':
+                host_log_level = ESP_LOG_DEBUG;
+                break;
+            default:
+                usage(argv[0]);
+        }
+    }
+    // Same time zone as the clock, for the dates of the scenarios
+    setenv("TZ", "CET-1CEST,M3.5.0,M10.5.0/3", 1);
+    tzset();
+
+    auto wall_start = std::chrono::steady_clock::now();
+    printf("%-14s %7s %7s %12s\n", "scenario", "checks", "failed", "simulated_s");
+
+    // A morning in winter, one scenario after the other on the same clock
+    boot(localTime(year, 1, 15, 6, 50, 30));
+    scenarioSetAlarm();
+    report();
+    scenarioTrigger(localTime(year, 1, 15, 6, 55, 0));
+    report();
+    scenarioSnooze();
+    report();
+    scenarioCancel();
+    report();
+    scenarioCancelWindow(localTime(year, 1, 16, 6, 55, 0));
+    report();
+    scenarioTimeStep(localTime(year, 1, 17, 6, 55, 0));
+    report();
+    scenarioAlarmPending(localTime(year, 1, 18, 6, 55, 0), localTime(year, 1, 19, 6, 55, 0));
+    report();
+    scenarioAudioStatus();
+    report();
+    int64_t simulated_us = esp_timer_get_time();
+    uint32_t timer_callbacks = host_timer_callbacks();
+    UBaseType_t high_water = host_queue_high_water(machine->getEventQueue());
+    uint32_t dropped_events = machine->getDroppedEvents();
+
+    if (days > 0) {
+        boot(localTime(year, 1, 1, 0, 0, 0));
+        runDays(year, days);
+        report();
+        simulated_us += esp_timer_get_time();
+        timer_callbacks += host_timer_callbacks();
+        dropped_events += machine->getDroppedEvents();
+        if (host_queue_high_water(machine->getEventQueue()) > high_water)
+            high_water = host_queue_high_water(machine->getEventQueue());
+    }
+
+    double wall_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+    double simulated_s = simulated_us / 1e6;
+    printf("\nsimulated %.0f s (%.1f days) in %.3f s, %.0fx real time\n", simulated_s, simulated_s / SIM_DAY_S, wall_s,
+           simulated_s / wall_s);
+    printf("events handled %llu, dropped %u, timer callbacks %u, event queue high water %u of %u\n",
+           (unsigned long long)events_handled, dropped_events, timer_callbacks, high_water, CLOCK_EVENT_QUEUE_LENGTH);
+    printf("%u checks, %u failed\n", checks, failures);
+    return failures == 0 ? 0 : 1;
+}
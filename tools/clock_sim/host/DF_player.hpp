@@ -0,0 +1,45 @@
+// Host stand-in for the DFPlayer of the clock. It records what it has been asked to play, the player is online unless
+// the simulation takes it offline
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+typedef int uart_port_t;
+
+typedef enum {
+    DFPLAYER_NO_EVENT = 0,
+    DFPLAYER_ONLINE,
+    DFPLAYER_WRONG_DATA,
+    DFPLAYER_PLAYER_ERROR,
+    DFPLAYER_CARD_INSERTED,
+    DFPLAYER_CARD_REMOVED,
+    DFPLAYER_PLAY_FINISHED,
+    DFPLAYER_RESPONSE_RECEIVED,
+    DFPLAYER_OFFLINE,
+} dfplayer_event_t;
+
+typedef void (*dfplayer_callback_t)(dfplayer_event_t event, void *arg);
+
+class DFPlayer {
+    dfplayer_callback_t event_callback = NULL;
+    void *event_callback_arg = NULL;
+
+   public:
+    bool init(uart_port_t uart_port_number, int tx_pin, int rx_pin);
+    void setEventCallback(dfplayer_callback_t callback, void *arg);
+    bool isDeviceOnline() { return online; }
+
+    void playTrack(int file_number);
+    void loopTrack(int file_number);
+    void stopTrack();
+    void setVolume(int volume);
+
+    // Simulation side
+    void simSetOnline(bool online);  // Reports the change as the real player does
+    bool online = true;
+    int track = 0;         // Track playing, 0 if stopped
+    bool looping = false;
+    int volume = 0;
+    uint32_t started = 0;  // Number of playTrack and loopTrack calls
+};
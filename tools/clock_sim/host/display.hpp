@@ -0,0 +1,72 @@
+// Host stand-in for the Display of the clock. Nothing is drawn: every updateContent is recorded as a command, together
+// with what each element shows after it. The element and action names are the ones of src/display.hpp
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+#include "clock_common.hpp"
+
+#define DISPLAY_ELEMENTS_NR 10
+
+typedef enum {
+    D_E_TIME = 0,
+    D_E_ALARM_TIME,
+    D_E_ALARM_ACTIVE,
+    D_E_BED_TIME,
+    D_E_SNOOZE_TIME,
+    D_E_SNOOZE_CANCEL,
+    D_E_WIFI_STATUS,
+    D_E_MQTT_STATUS,
+    D_E_WIFI_SETTING,
+    D_E_AUDIO,
+} display_element_t;
+
+typedef enum {
+    D_A_OFF = 0,
+    D_A_ON,
+    D_A_HIDE_HOURS,
+    D_A_HIDE_MINUTES,
+    D_A_ONE_BAR,
+    D_A_TWO_BARS,
+} display_action_t;
+
+typedef struct {
+    int64_t time_us;   // Virtual time of the command
+    display_element_t element;
+    display_action_t action;
+    bool with_value;
+    bool value_valid;  // false if NULL has been passed as value
+    union {
+        clock_time_t time;
+        uint16_t seconds;  // Only for D_E_SNOOZE_TIME
+    } value;
+} display_command_t;
+
+class Display {
+    uint8_t frame_depth = 0;
+    void record(display_element_t element, void *value, display_action_t action, bool with_value);
+
+   public:
+    void init(void) {}
+    void updateContent(display_element_t element, void *value, display_action_t action);
+    void updateContent(display_element_t element, display_action_t action);
+    void setMaxBrightness(bool request_max_brightness) { max_brightness = request_max_brightness; }
+    void setIncreasedBrightness(bool request_inc_brightness) { increased_brightness = request_inc_brightness; }
+    bool isDisplayOn(void) { return display_on; }
+    void beginFrame(void) { frame_depth++; }
+    void endFrame(void);
+    void setDigitRoll(bool enable) {}
+    void setAnalogFace(bool enable) {}
+    void sampleAmbientLight(void) {}
+
+    // Simulation side
+    std::vector<display_command_t> commands;       // Since the last clear, unless record_commands is false
+    bool record_commands = true;
+    display_command_t shown[DISPLAY_ELEMENTS_NR] = {};  // Last command of each element
+    uint32_t updates[DISPLAY_ELEMENTS_NR] = {};         // Commands of each element
+    uint32_t frames = 0;
+    uint32_t outside_frame = 0;  // Commands not within beginFrame and endFrame, each one would be a frame of its own
+    bool increased_brightness = false;
+    bool max_brightness = false;
+    bool display_on = true;      // The backlight, off in a dark room
+};
@@ -0,0 +1,27 @@
+// Host stand-in for the FreeRTOS API used by ClockMachine. There is a single thread: queues never block, the
+// simulation takes the events out of the queue itself (see host_sim.hpp). The other FreeRTOS headers just include
+// this one
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE 0
+#define pdTRUE  1
+#define pdPASS  pdTRUE
+
+#define portTICK_PERIOD_MS 1
+#define portMAX_DELAY      ((TickType_t)0xFFFFFFFF)
+
+typedef struct host_queue_t *QueueHandle_t;
+
+// A full queue fails right away, whatever the timeout
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size);
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks_to_wait);
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void *item, BaseType_t *higher_priority_task_woken);
+BaseType_t xQueueReceive(QueueHandle_t queue, void *buffer, TickType_t ticks_to_wait);
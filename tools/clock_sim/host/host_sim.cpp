@@ -0,0 +1,207 @@
+// Virtual clock, esp_timer, queues and NVS of the simulation (see host_sim.hpp)
+
+#include <string.h>
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "esp_timer.h"
+#include "freertos/queue.h"
+#include "host_sim.hpp"
+#include "nvs.h"
+#include "sys/time.h"
+
+esp_log_level_t host_log_level = ESP_LOG_WARN;
+
+struct esp_timer {
+    esp_timer_cb_t callback;
+    void *arg;
+    bool active;
+    int64_t expiry_us;
+    uint64_t period_us;  // 0 for one-shot timers
+};
+
+struct host_queue_t {
+    UBaseType_t length;
+    UBaseType_t item_size;
+    UBaseType_t high_water;
+    std::deque<std::vector<uint8_t>> items;
+};
+
+static int64_t now_us = 0;
+static int64_t wall_offset_us = 0;  // Wall clock (since the epoch) - virtual time
+static uint32_t timer_callbacks = 0;
+// Never freed: ClockMachine has no destructor, it lives as long as the clock. host_reset only stops the timers
+static std::vector<std::unique_ptr<esp_timer>> timers;
+static std::vector<std::unique_ptr<host_queue_t>> queues;
+static std::map<std::string, std::vector<uint8_t>> nvs_storage;
+
+void host_reset(void) {
+    for (auto &timer : timers)
+        timer->active = false;
+    for (auto &queue : queues)
+        queue->items.clear();
+    nvs_storage.clear();
+    now_us = 0;
+    wall_offset_us = 0;
+    timer_callbacks = 0;
+}
+
+void host_set_wall_clock(time_t now) {
+    wall_offset_us = (int64_t)now * 1000000 - now_us;
+}
+
+time_t host_wall_clock(void) {
+    return (time_t)((wall_offset_us + now_us) / 1000000);
+}
+
+int host_gettimeofday(struct timeval *tv, void *tz) {
+    int64_t wall_us = wall_offset_us + now_us;
+    tv->tv_sec = (time_t)(wall_us / 1000000);
+    tv->tv_usec = (suseconds_t)(wall_us % 1000000);
+    return 0;
+}
+
+bool host_run_next_timer(int64_t until_us) {
+    esp_timer *next = NULL;
+    for (auto &timer : timers) {
+        if (timer->active && timer->expiry_us <= until_us && (next == NULL || timer->expiry_us < next->expiry_us))
+            next = timer.get();
+    }
+    if (next == NULL) {
+        if (until_us > now_us)
+            now_us = until_us;
+        return false;
+    }
+    if (next->expiry_us > now_us)
+        now_us = next->expiry_us;
+    if (next->period_us > 0) {
+        next->expiry_us += next->period_us;
+    } else {
+        next->active = false;
+    }
+    timer_callbacks++;
+    next->callback(next->arg);
+    return true;
+}
+
+uint32_t host_timer_callbacks(void) {
+    return timer_callbacks;
+}
+
+UBaseType_t host_queue_high_water(QueueHandle_t queue) {
+    return queue->high_water;
+}
+
+//-------------//
+//  ESP TIMER  //
+//-------------//
+
+int64_t esp_timer_get_time(void) {
+    return now_us;
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *create_args, esp_timer_handle_t *out_handle) {
+    timers.emplace_back(new esp_timer{create_args->callback, create_args->arg, false, 0, 0});
+    *out_handle = timers.back().get();
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us) {
+    if (timer->active)
+        return ESP_ERR_INVALID_STATE;
+    timer->active = true;
+    timer->expiry_us = now_us + (int64_t)timeout_us;
+    timer->period_us = 0;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period) {
+    if (timer->active)
+        return ESP_ERR_INVALID_STATE;
+    timer->active = true;
+    timer->expiry_us = now_us + (int64_t)period;
+    timer->period_us = period;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer) {
+    if (!timer->active)
+        return ESP_ERR_INVALID_STATE;
+    timer->active = false;
+    return ESP_OK;
+}
+
+bool esp_timer_is_active(esp_timer_handle_t timer) {
+    return timer->active;
+}
+
+//-----------//
+//  QUEUES   //
+//-----------//
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size) {
+    queues.emplace_back(new host_queue_t{length, item_size, 0, {}});
+    return queues.back().get();
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks_to_wait) {
+    if (queue->items.size() >= queue->length)
+        return pdFALSE;
+    const uint8_t *bytes = (const uint8_t *)item;
+    queue->items.emplace_back(bytes, bytes + queue->item_size);
+    if (queue->items.size() > queue->high_water)
+        queue->high_water = queue->items.size();
+    return pdTRUE;
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void *item, BaseType_t *higher_priority_task_woken) {
+    *higher_priority_task_woken = pdTRUE;
+    return xQueueSend(queue, item, 0);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *buffer, TickType_t ticks_to_wait) {
+    if (queue->items.empty())
+        return pdFALSE;
+    memcpy(buffer, queue->items.front().data(), queue->item_size);
+    queue->items.pop_front();
+    return pdTRUE;
+}
+
+//-------//
+//  NVS  //
+//-------//
+
+esp_err_t nvs_open(const char *name, nvs_open_mode_t open_mode, nvs_handle_t *out_handle) {
+    *out_handle = 1;
+    return ESP_OK;
+}
+
+void nvs_close(nvs_handle_t handle) {
+}
+
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char *key, void *out_value, size_t *length) {
+    auto entry = nvs_storage.find(key);
+    if (entry == nvs_storage.end())
+        return ESP_ERR_NVS_NOT_FOUND;
+    if (*length > entry->second.size())
+        *length = entry->second.size();
+    memcpy(out_value, entry->second.data(), *length);
+    return ESP_OK;
+}
+
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char *key, const void *value, size_t length) {
+    const uint8_t *bytes = (const uint8_t *)value;
+    nvs_storage[key] = std::vector<uint8_t>(bytes, bytes + length);
+    return ESP_OK;
+}
+
+esp_err_t nvs_get_u8(nvs_handle_t handle, const char *key, uint8_t *out_value) {
+    size_t length = 1;
+    return nvs_get_blob(handle, key, out_value, &length);
+}
+
+esp_err_t nvs_set_u8(nvs_handle_t handle, const char *key, uint8_t value) {
+    return nvs_set_blob(handle, key, &value, 1);
+}
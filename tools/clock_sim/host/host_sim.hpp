@@ -0,0 +1,25 @@
+// Controls of the host environment in which ClockMachine is simulated (see README.md). Time is virtual: it only
+// advances when the simulation runs the timers, so a day takes as long as the events of that day need
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+
+extern esp_log_level_t host_log_level;
+
+// Forgets all timers, queues and NVS contents, and resets the virtual clock to boot time
+void host_reset(void);
+
+// Sets the wall clock so that it shows now at the current virtual time
+void host_set_wall_clock(time_t now);
+time_t host_wall_clock(void);
+
+// Calls the callback of the next timer due at or before until_us, after advancing the virtual time to its expiry.
+// Returns false, after advancing the virtual time to until_us, if there is none
+bool host_run_next_timer(int64_t until_us);
+
+uint32_t host_timer_callbacks(void);
+UBaseType_t host_queue_high_water(QueueHandle_t queue);
@@ -0,0 +1,185 @@
+// Implementations of the stand-ins for the modules ClockMachine drives (display.hpp, DF_player.hpp, wifi_time.hpp,
+// rotary_encoder.hpp)
+
+#include <stdlib.h>
+#include <string.h>
+#include "DF_player.hpp"
+#include "display.hpp"
+#include "esp_timer.h"
+#include "host_sim.hpp"
+#include "rotary_encoder.hpp"
+#include "wifi_time.hpp"
+
+//-----------//
+//  DISPLAY  //
+//-----------//
+
+void Display::record(display_element_t element, void *value, display_action_t action, bool with_value) {
+    display_command_t command = {};
+    command.time_us = esp_timer_get_time();
+    command.element = element;
+    command.action = action;
+    command.with_value = with_value;
+    command.value_valid = (value != NULL);
+    if (value != NULL) {
+        if (element == D_E_SNOOZE_TIME)
+            command.value.seconds = *(uint16_t *)value;
+        else
+            command.value.time = *(clock_time_t *)value;
+    }
+    if (frame_depth == 0)
+        outside_frame++;
+    shown[element] = command;
+    updates[element]++;
+    if (record_commands)
+        commands.push_back(command);
+}
+
+void Display::updateContent(display_element_t element, void *value, display_action_t action) {
+    record(element, value, action, true);
+}
+
+void Display::updateContent(display_element_t element, display_action_t action) {
+    record(element, NULL, action, false);
+}
+
+void Display::endFrame(void) {
+    assert(frame_depth > 0);
+    if (--frame_depth == 0)
+        frames++;
+}
+
+//------------//
+//  DFPLAYER  //
+//------------//
+
+bool DFPlayer::init(uart_port_t uart_port_number, int tx_pin, int rx_pin) {
+    // The real player answers the reset with its online message
+    if (event_callback != NULL)
+        event_callback(DFPLAYER_ONLINE, event_callback_arg);
+    return true;
+}
+
+void DFPlayer::setEventCallback(dfplayer_callback_t callback, void *arg) {
+    event_callback_arg = arg;
+    event_callback = callback;
+}
+
+void DFPlayer::playTrack(int file_number) {
+    track = file_number;
+    looping = false;
+    started++;
+}
+
+void DFPlayer::loopTrack(int file_number) {
+    track = file_number;
+    looping = true;
+    started++;
+}
+
+void DFPlayer::stopTrack() {
+    track = 0;
+    looping = false;
+}
+
+void DFPlayer::setVolume(int volume) {
+    this->volume = volume;
+}
+
+void DFPlayer::simSetOnline(bool online) {
+    this->online = online;
+    if (event_callback != NULL)
+        event_callback(online ? DFPLAYER_ONLINE : DFPLAYER_OFFLINE, event_callback_arg);
+}
+
+//------------//
+//  WIFITIME  //
+//------------//
+
+void WifiTime::init(wifi_credentials_t *credentials, QueueHandle_t clock_event_queue) {
+    wifi_credentials = credentials;
+    event_queue = clock_event_queue;
+    // Same time zone as the clock
+    setenv("TZ", "CET-1CEST,M3.5.0,M10.5.0/3", 1);
+    tzset();
+}
+
+void WifiTime::postEvent(clock_event_type_t type) {
+    clock_event_t event = {};
+    event.type = type;
+    if (xQueueSend(event_queue, &event, 0) != pdTRUE)
+        dropped_events++;
+}
+
+void WifiTime::getTime(clock_time_t *t) {
+    time_t now = host_wall_clock();
+    struct tm timeinfo;
+    localtime_r(&now, &timeinfo);
+
+    t->hour = (uint8_t)timeinfo.tm_hour;
+    t->minute = (uint8_t)timeinfo.tm_min;
+}
+
+void WifiTime::simSetWifiConnected(bool connected) {
+    wifi_is_connected = connected;
+    if (connected)
+        wps_is_active = false;
+    postEvent(CLOCK_EVENT_WIFI_STATUS);
+    #ifdef MQTT_ACTIVE
+    postEvent(CLOCK_EVENT_MQTT_STATUS);
+    #endif
+}
+
+void WifiTime::simSyncTime(time_t now) {
+    host_set_wall_clock(now);
+    postEvent(CLOCK_EVENT_TIME_SET);
+}
+
+//-----------------//
+//  ROTARYENCODER  //
+//-----------------//
+
+void RotaryEncoder::setEventCallback(rotary_encoder_callback_t callback, void *arg) {
+    event_callback_arg = arg;
+    event_callback = callback;
+}
+
+void RotaryEncoder::setRange(rotary_encoder_pos_t min, rotary_encoder_pos_t max, rotary_encoder_pos_t step, bool wrap) {
+    assert(min <= max);
+    assert(step >= 1);
+    assert(!(wrap && step > 1));
+
+    min_position = min;
+    max_position = max;
+
+    if (position < min) {
+        position = min;
+    } else if (position > max) {
+        position = max;
+    }
+    step_increment = step;
+    wrap_values = wrap;
+}
+
+void RotaryEncoder::simRotate(rotary_encoder_dir_t direction) {
+    // Same as the interrupt handler at the end of a detent
+    if (direction == DIR_RIGHT) {
+        position += step_increment;
+        if (position > max_position)
+            position = wrap_values ? min_position : max_position;
+    } else {
+        position -= step_increment;
+        if (position < min_position)
+            position = wrap_values ? max_position : min_position;
+    }
+    rotary_encoder_event_t event = {ENCODER_ROTATION, position, direction};
+    if (event_callback != NULL)
+        event_callback(&event, true, event_callback_arg);
+}
+
+void RotaryEncoder::simPress(bool long_press) {
+    // Same as the button task once the button is released, or held long enough
+    rotary_encoder_event_t event = {long_press ? BUTTON_LONG_PRESS : BUTTON_SHORT_PRESS, position, DIR_NONE};
+    if (event_callback != NULL)
+        event_callback(&event, false, event_callback_arg);
+}
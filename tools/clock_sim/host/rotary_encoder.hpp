@@ -0,0 +1,54 @@
+// Host stand-in for the RotaryEncoder of the clock. There is no hardware: the simulation turns and presses it with
+// simRotate and simPress, which report the events like the interrupt handler and the button task do
+#pragma once
+
+#include <assert.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "driver/gpio.h"
+
+#define LONG_PRESS_DURATION (1000)
+
+typedef int16_t rotary_encoder_pos_t;
+
+typedef enum {
+    DIR_NONE = 0,
+    DIR_RIGHT,
+    DIR_LEFT,
+} rotary_encoder_dir_t;
+
+typedef enum {
+    ENCODER_ROTATION = 0,
+    BUTTON_SHORT_PRESS,
+    BUTTON_LONG_PRESS,
+} rotary_encoder_event_type_t;
+
+typedef struct
+{
+    rotary_encoder_event_type_t type;
+    rotary_encoder_pos_t position;
+    rotary_encoder_dir_t direction;
+} rotary_encoder_event_t;
+
+typedef bool (*rotary_encoder_callback_t)(const rotary_encoder_event_t *event, bool in_isr, void *arg);
+
+class RotaryEncoder {
+    rotary_encoder_callback_t event_callback = NULL;
+    void *event_callback_arg = NULL;
+    rotary_encoder_pos_t position = 0;
+    rotary_encoder_pos_t min_position = INT16_MIN;
+    rotary_encoder_pos_t max_position = INT16_MAX;
+    rotary_encoder_pos_t step_increment = 1;
+    bool wrap_values = false;
+
+   public:
+    QueueHandle_t init(gpio_num_t pin_a, gpio_num_t pin_b, gpio_num_t pin_button, bool inverted) { return NULL; }
+    void setEventCallback(rotary_encoder_callback_t callback, void *arg);
+    void setRange(rotary_encoder_pos_t min, rotary_encoder_pos_t max, rotary_encoder_pos_t step, bool wrap);
+    void setPosition(rotary_encoder_pos_t new_position) { position = new_position; }
+    rotary_encoder_pos_t getPosition() { return position; }
+
+    // Simulation side
+    void simRotate(rotary_encoder_dir_t direction);
+    void simPress(bool long_press);
+};
@@ -0,0 +1,7 @@
+// The wall clock of ClockMachine is the virtual clock of the simulation (see host_sim.hpp)
+#pragma once
+
+#include_next <sys/time.h>
+
+int host_gettimeofday(struct timeval *tv, void *tz);
+#define gettimeofday host_gettimeofday
@@ -0,0 +1,39 @@
+// Host stand-in for the WifiTime of the clock. The time comes from the virtual clock of the simulation, in the time
+// zone of the clock. WiFi, WPS and MQTT are switched by the simulation, with the same events the real one posts
+#pragma once
+
+#include <time.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "clock_events.hpp"
+#include "mqtt_config.hpp"
+
+class WifiTime {
+    QueueHandle_t event_queue;
+    wifi_credentials_t *wifi_credentials;
+    bool wifi_is_connected = true;
+    bool wps_is_active = false;
+    uint32_t dropped_events = 0;
+    void postEvent(clock_event_type_t type);
+
+   public:
+    void init(wifi_credentials_t *credentials, QueueHandle_t clock_event_queue);
+    void startWPS(void) { wps_is_active = true; }
+    void stopWPS(void) { wps_is_active = false; }
+    bool isWPSActive(void) { return wps_is_active; }
+    bool isTimeSet(void) { return true; }
+    bool isWifiConnected(void) { return wifi_is_connected; }
+    void getTime(clock_time_t *time);
+    uint32_t getDroppedEvents(void) { return dropped_events; }
+    #ifdef MQTT_ACTIVE
+    bool isMQTTConnected(void) { return wifi_is_connected; }
+    void sendMQTTAlarmTriggered(void) { mqtt_alarms_triggered++; }
+    void sendMQTTAlarmStopped(void) { mqtt_alarms_stopped++; }
+    uint32_t mqtt_alarms_triggered = 0;
+    uint32_t mqtt_alarms_stopped = 0;
+    #endif
+
+    // Simulation side
+    void simSetWifiConnected(bool connected);
+    void simSyncTime(time_t now);  // Sets the wall clock, as an SNTP sync does
+};
@@ -0,0 +1,303 @@
+/*
+Runs the Display class of the clock on Linux, on top of an emulated ILI9341 (see host/ and README.md).
+
+A fixed sequence of updateContent calls is played, as the clock would do it, covering every element and action
+handled by Display. For each of them the SPI traffic the panel has received is printed: bus transactions, commands,
+pixels and bytes. Optionally a snapshot of the screen is written after each step as PPM file.
+
+Every step has a budget of pixels it may write. Exceeding it, or a snapshot differing from the golden image given
+with -g, makes the emulator fail, so it can be used as a regression check of the rendering.
+*/
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <display.hpp>
+#include "host_emulator.hpp"
+
+typedef struct {
+    const char *name;
+    display_element_t element;
+    display_action_t action;
+    bool with_value;  // Use the updateContent variant with a value
+    clock_time_t time;
+    uint16_t seconds;  // Value for D_E_SNOOZE_TIME
+    uint32_t max_pixels;  // Budget, with or without back buffers
+} emulator_step_t;
+
+// The budgets are about 25 % above the pixels written today, the most of both drawing paths
+static const emulator_step_t steps[] = {
+    {"time_0759", D_E_TIME, D_A_ON, true, {7, 59}, 0, 49000},
+    {"time_0800", D_E_TIME, D_A_ON, true, {8, 0}, 0, 24600},
+    {"time_0801", D_E_TIME, D_A_ON, true, {8, 1}, 0, 8000},
+    {"time_1959", D_E_TIME, D_A_ON, true, {19, 59}, 0, 32400},
+    {"alarm_time_off", D_E_ALARM_TIME, D_A_OFF, true, {7, 0}, 0, 8200},
+    {"alarm_time_on", D_E_ALARM_TIME, D_A_ON, true, {7, 0}, 0, 7900},
+    {"alarm_time_hide_hours", D_E_ALARM_TIME, D_A_HIDE_HOURS, true, {7, 0}, 0, 2400},
+    {"alarm_time_hide_minutes", D_E_ALARM_TIME, D_A_HIDE_MINUTES, true, {7, 15}, 0, 5400},
+    {"alarm_time_on_0715", D_E_ALARM_TIME, D_A_ON, true, {7, 15}, 0, 2400},
+    {"bed_time_on", D_E_BED_TIME, D_A_ON, true, {7, 30}, 0, 6700},
+    {"bed_time_on_0729", D_E_BED_TIME, D_A_ON, true, {7, 29}, 0, 2400},
+    {"bed_time_on_9h", D_E_BED_TIME, D_A_ON, true, {9, 0}, 0, 7400},
+    {"bed_time_on_0859", D_E_BED_TIME, D_A_ON, true, {8, 59}, 0, 6700},
+    {"bed_time_off", D_E_BED_TIME, D_A_OFF, true, {8, 59}, 0, 7400},
+    {"alarm_active_on", D_E_ALARM_ACTIVE, D_A_ON, false, {0, 0}, 0, 1500},
+    {"alarm_active_off", D_E_ALARM_ACTIVE, D_A_OFF, false, {0, 0}, 0, 1500},
+    {"snooze_time_300", D_E_SNOOZE_TIME, D_A_ON, true, {0, 0}, 300, 6600},
+    {"snooze_time_299", D_E_SNOOZE_TIME, D_A_ON, true, {0, 0}, 299, 4300},
+    {"snooze_time_240", D_E_SNOOZE_TIME, D_A_ON, true, {0, 0}, 240, 2400},
+    {"snooze_cancel_one_bar", D_E_SNOOZE_CANCEL, D_A_ONE_BAR, false, {0, 0}, 0, 300},
+    {"snooze_cancel_two_bars", D_E_SNOOZE_CANCEL, D_A_TWO_BARS, false, {0, 0}, 0, 300},
+    {"snooze_cancel_off", D_E_SNOOZE_CANCEL, D_A_OFF, false, {0, 0}, 0, 500},
+    {"snooze_time_off", D_E_SNOOZE_TIME, D_A_OFF, true, {0, 0}, 0, 8300},
+    {"wifi_status_off", D_E_WIFI_STATUS, D_A_OFF, false, {0, 0}, 0, 1600},
+    {"wifi_status_on", D_E_WIFI_STATUS, D_A_ON, false, {0, 0}, 0, 1600},
+#ifdef MQTT_ACTIVE
+    {"mqtt_status_off", D_E_MQTT_STATUS, D_A_OFF, false, {0, 0}, 0, 1600},
+    {"mqtt_status_on", D_E_MQTT_STATUS, D_A_ON, false, {0, 0}, 0, 1500},
+#endif
+    {"wifi_setting_on", D_E_WIFI_SETTING, D_A_ON, false, {0, 0}, 0, 11900},
+    {"wifi_setting_off", D_E_WIFI_SETTING, D_A_OFF, false, {0, 0}, 0, 14000},
+    {"audio_off", D_E_AUDIO, D_A_OFF, false, {0, 0}, 0, 1300},
+    {"audio_on", D_E_AUDIO, D_A_ON, false, {0, 0}, 0, 2400},
+};
+
+// Ambient light which makes Display switch to the night palette: the brightness goes down to the lowest level which
+// still has the backlight on (see display_light_thd_down)
+#define EMULATOR_NIGHT_LIGHT 24
+// Ambient light the emulator starts with (see host_rtos.cpp), the day palette is used
+#define EMULATOR_DAY_LIGHT   70
+
+// Compares the frame memory with a PPM file written by writePPM. Returns the number of different pixels, -1 if the
+// file could not be read
+static int32_t compareWithGolden(const char *path) {
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+        return -1;
+    int width, height, max_value;
+    if (fscanf(file, "P6 %d %d %d", &width, &height, &max_value) != 3 || fgetc(file) == EOF ||
+        width != lgfx::host_panel->width() || height != lgfx::host_panel->height()) {
+        fclose(file);
+        return -1;
+    }
+
+    int32_t differences = 0;
+    for (int32_t y = 0; y < height; y++) {
+        for (int32_t x = 0; x < width; x++) {
+            uint8_t rgb[3];
+            if (fread(rgb, 1, sizeof(rgb), file) != sizeof(rgb)) {
+                fclose(file);
+                return -1;
+            }
+            uint32_t rgb888 = lgfx::LovyanGFX::color888(lgfx::host_panel->readPixel(x, y));
+            if (rgb888 != (((uint32_t)rgb[0] << 16) | ((uint32_t)rgb[1] << 8) | rgb[2]))
+                differences++;
+        }
+    }
+    fclose(file);
+    return differences;
+}
+
+// Compares the frame memory with the back buffers as read for a snapshot over the console. Returns the number of
+// different pixels, -1 if the back buffers do not cover the screen
+static int32_t compareWithBackBuffers(Display *display) {
+    int32_t differences = 0;
+    uint16_t pixels[DISPLAY_WIDTH];
+    for (int32_t y = 0; y < DISPLAY_HEIGHT; y++) {
+        if (!display->readScreenRow(y, pixels))
+            return -1;
+        for (int32_t x = 0; x < DISPLAY_WIDTH; x++) {
+            if (pixels[x] != lgfx::host_panel->readPixel(x, y))
+                differences++;
+        }
+    }
+    return differences;
+}
+
+// Checks the screen after a step: against the back buffers and the golden image, if given. Writes the snapshot if
+// requested. Returns the number of failed checks, -1 if the snapshot could not be written
+static int checkScreen(Display *display, const char *name, const char *golden_dir, const char *snapshot_dir) {
+    int failures = 0;
+    // With back buffers a snapshot has to show exactly what the panel shows
+    if (display->getBackBufferBytes() > 0) {
+        int32_t differences = compareWithBackBuffers(display);
+        if (differences != 0) {
+            printf("    FAIL: %d pixels of the back buffers differ from the panel\n", (int)differences);
+            failures++;
+        }
+    }
+
+    char path[256];
+    if (golden_dir != NULL) {
+        snprintf(path, sizeof(path), "%s/%s.ppm", golden_dir, name);
+        int32_t differences = compareWithGolden(path);
+        if (differences != 0) {
+            if (differences < 0) {
+                printf("    FAIL: golden image %s could not be read\n", path);
+            } else {
+                printf("    FAIL: %d pixels differ from %s\n", (int)differences, path);
+            }
+            failures++;
+        }
+    }
+    if (snapshot_dir != NULL) {
+        snprintf(path, sizeof(path), "%s/%s.ppm", snapshot_dir, name);
+        if (!lgfx::host_panel->writePPM(path)) {
+            fprintf(stderr, "Could not write %s\n", path);
+            return -1;
+        }
+    }
+    return failures;
+}
+
+// Changes the ambient light so that Display switches to the night palette or back to the day one, and checks the
+// screen once the switch has been drawn. Returns the number of failed checks, -1 if the snapshot could not be written
+static int switchPalette(Display *display, bool night_palette, const char *golden_dir, const char *snapshot_dir) {
+    // The brightness task notices the light when it samples it along with the next time update, tracks it and then
+    // switches the palette. Everything on the screen is drawn again in the new colours, on every drawing path
+    const char *name = night_palette ? "night_palette" : "day_palette";
+    lgfx::panel_stats_t before = lgfx::host_panel->getStats();
+    host_ambient_light = night_palette ? EMULATOR_NIGHT_LIGHT : EMULATOR_DAY_LIGHT;
+    display->sampleAmbientLight();
+    while (display->isNightPalette() != night_palette) {
+        usleep(1000);
+    }
+    host_wait_idle();
+    const lgfx::panel_stats_t &after = lgfx::host_panel->getStats();
+    printf("%-3s %-24s %6u %8u %8u %8u\n", "-", name, after.transactions - before.transactions,
+           after.commands - before.commands, after.pixels - before.pixels, after.bytes - before.bytes);
+    return checkScreen(display, name, golden_dir, snapshot_dir);
+}
+
+static void usage(const char *program) {
+    fprintf(stderr, "Usage: %s [-o snapshot_dir] [-g golden_dir] [-m free_heap_bytes] [-r] [-a] [-n] [-v]\n", program);
+    fprintf(stderr, "  -o  write a PPM snapshot of the screen after every step into this directory\n");
+    fprintf(stderr, "  -g  compare the screen after every step with the snapshots in this directory\n");
+    fprintf(stderr, "  -m  free heap reported to Display (default %d), e.g. 0 to draw without back buffers\n",
+            (int)host_free_heap);
+    fprintf(stderr, "  -r  roll the digits of the time, the pixel budgets are not checked then\n");
+    fprintf(stderr, "  -a  show the time on the analog face instead of the digits\n");
+    fprintf(stderr, "  -n  lower the ambient light after the first step and raise it again before the end of the snooze\n");
+    fprintf(stderr, "      cancel sequence, so that the night palette is used in between\n");
+    fprintf(stderr, "  -v  show the debug logs of Display\n");
+}
+
+int main(int argc, char *argv[]) {
+    const char *snapshot_dir = NULL;
+    const char *golden_dir = NULL;
+    bool digit_roll = false;
+    bool analog_face = false;
+    bool night = false;
+    int option;
+    while ((option = getopt(argc, argv, "o:g:m:ranvh")) != -1) {
+        switch (option) {
+            case 'o':
+                snapshot_dir = optarg;
+                break;
+            case 'g':
+                golden_dir = optarg;
+                break;
+            case 'm':
+                host_free_heap = strtoul(optarg, NULL, 0);
+                break;
+            case 'r':
+                digit_roll = true;
+                break;
+            case 'a':
+                analog_face = true;
+                break;
+            case 'n':
+                night = true;
+                break;
+            case 'v':
+                host_log_level = ESP_LOG_DEBUG;
+                break;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+
+    Display display;
+    display.init();
+    display.setDigitRoll(digit_roll);
+    display.setAnalogFace(analog_face);
+    // The brightness is set once the first block of samples has been through the light pipeline
+    while (!display.getLightState()->valid) {
+        usleep(1000);
+    }
+    host_wait_idle();
+    printf("memory: back buffers %u bytes (%d bpp), digit cache %u bytes\n", display.getBackBufferBytes(),
+           DISPLAY_BACK_BUFFER_BPP, display.getDigitCacheBytes());
+
+    printf("%-3s %-24s %6s %8s %8s %8s %8s %8s %8s\n", "nr", "step", "trans", "commands", "pixels", "bytes", "drawn",
+           "saved", "frame_us");
+    lgfx::panel_stats_t total = {};
+    int failures = 0;
+    for (size_t s = 0; s < sizeof(steps) / sizeof(steps[0]); s++) {
+        const emulator_step_t *step = &steps[s];
+        lgfx::panel_stats_t before = lgfx::host_panel->getStats();
+
+        // The night palette is used from the second step on, up to the bars of the snooze cancel sequence, so that
+        // the switches recolour the time alone as well as most of the elements at once
+        if (night && (s == 1 || strcmp(step->name, "snooze_cancel_off") == 0)) {
+            int switch_failures = switchPalette(&display, s == 1, golden_dir, snapshot_dir);
+            if (switch_failures < 0)
+                return 1;
+            failures += switch_failures;
+            before = lgfx::host_panel->getStats();
+        }
+
+        if (step->with_value) {
+            clock_time_t time = step->time;
+            uint16_t seconds = step->seconds;
+            void *value = (step->element == D_E_SNOOZE_TIME) ? (void *)&seconds : (void *)&time;
+            display.updateContent(step->element, value, step->action);
+        } else {
+            display.updateContent(step->element, step->action);
+        }
+        host_wait_idle();
+        // Between the frames of an animation the render task waits with a timeout, which counts as idle
+        while (display.isRolling()) {
+            usleep(1000);
+            host_wait_idle();
+        }
+
+        const lgfx::panel_stats_t &after = lgfx::host_panel->getStats();
+        lgfx::panel_stats_t delta = {
+            after.transactions - before.transactions,
+            after.commands - before.commands,
+            after.pixels - before.pixels,
+            after.bytes - before.bytes,
+        };
+        total.transactions += delta.transactions;
+        total.commands += delta.commands;
+        total.pixels += delta.pixels;
+        total.bytes += delta.bytes;
+        printf("%-3d %-24s %6u %8u %8u %8u %8u %8u %8lld\n", (int)s, step->name, delta.transactions, delta.commands,
+               delta.pixels, delta.bytes, display.getDrawnPixels(), display.getSavedBytes(),
+               (long long)display.getLastFrameTime());
+
+        if (!digit_roll && delta.pixels > step->max_pixels) {
+            printf("    FAIL: %u pixels written, the budget is %u\n", delta.pixels, step->max_pixels);
+            failures++;
+        }
+
+        int step_failures = checkScreen(&display, step->name, golden_dir, snapshot_dir);
+        if (step_failures < 0)
+            return 1;
+        failures += step_failures;
+    }
+    printf("%-28s %6u %8u %8u %8u\n", "total", total.transactions, total.commands, total.pixels, total.bytes);
+    if (digit_roll) {
+        printf("%u frames of rolling digits dropped\n", display.getDroppedFrames());
+    }
+
+    if (failures > 0) {
+        printf("%d checks failed\n", failures);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,16 @@
+// Host stand-in for the ESP-IDF heap functions. The free heap reported to Display is set with host_free_heap, so
+// the fallbacks for low memory (no back buffers, no digit cache) can be exercised as well
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_DMA  (1 << 3)
+#define MALLOC_CAP_8BIT (1 << 2)
+
+extern size_t host_free_heap;
+
+size_t heap_caps_get_free_size(uint32_t caps);
+void *heap_caps_malloc(size_t size, uint32_t caps);
+void heap_caps_free(void *ptr);
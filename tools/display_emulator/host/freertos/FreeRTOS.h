@@ -0,0 +1,47 @@
+// Host stand-in for the FreeRTOS API used by Display. Tasks are threads, critical sections are mutexes. Everything
+// is declared here, the other FreeRTOS headers just include this one
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <mutex>
+#include "esp_err.h"
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdFALSE 0
+#define pdTRUE  1
+#define pdPASS  pdTRUE
+
+#define portTICK_PERIOD_MS 1
+#define portMAX_DELAY      ((TickType_t)0xFFFFFFFF)
+
+typedef struct host_task_t *TaskHandle_t;
+typedef struct host_queue_t *QueueHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+// Spinlocks become plain mutexes, there is a single core anyway on the ESP32-C3
+struct portMUX_TYPE {
+    std::recursive_mutex mutex;
+};
+#define portMUX_INITIALIZER_UNLOCKED {}
+#define portENTER_CRITICAL(mux)      (mux)->mutex.lock()
+#define portEXIT_CRITICAL(mux)       (mux)->mutex.unlock()
+
+BaseType_t xTaskCreate(TaskFunction_t function, const char *name, uint32_t stack_depth, void *parameters,
+                       UBaseType_t priority, TaskHandle_t *created_task);
+void vTaskDelay(TickType_t ticks);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+uint32_t ulTaskNotifyTake(BaseType_t clear_count_on_exit, TickType_t ticks_to_wait);
+
+// Only setting bits is supported
+typedef enum { eSetBits = 1 } eNotifyAction;
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action);
+BaseType_t xTaskNotifyWait(uint32_t bits_to_clear_on_entry, uint32_t bits_to_clear_on_exit, uint32_t *notification_value,
+                           TickType_t ticks_to_wait);
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size);
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks_to_wait);
+BaseType_t xQueueReceive(QueueHandle_t queue, void *buffer, TickType_t ticks_to_wait);
@@ -0,0 +1,16 @@
+// Controls of the host environment in which Display runs on Linux (see README.md)
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_log.h"
+
+extern esp_log_level_t host_log_level;
+extern uint16_t host_ambient_light;  // Raw value returned by every ADC read
+extern size_t host_free_heap;        // Free heap reported to Display, for both DMA and 8 bit capable memory
+
+// Blocks until all tasks wait for something (notification, queue) which is not available yet, i.e. until Display
+// has finished processing everything it has been asked for
+void host_wait_idle(void);
+
+uint32_t host_backlight_duty(void);
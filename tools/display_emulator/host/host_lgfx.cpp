@@ -0,0 +1,288 @@
+// Drawing primitives of the LovyanGFX stand-in and the emulated ILI9341
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include "esp_heap_caps.h"
+#include "lgfx/v1_init.hpp"
+
+namespace lgfx {
+
+#define ILI9341_SLPIN  0x10
+#define ILI9341_SLPOUT 0x11
+#define ILI9341_CASET  0x2A
+#define ILI9341_PASET  0x2B
+#define ILI9341_RAMWR  0x2C
+
+Panel_ILI9341 *host_panel = nullptr;
+
+Panel_ILI9341::Panel_ILI9341(void) {
+    host_panel = this;
+}
+
+void Panel_ILI9341::init(int32_t width, int32_t height) {
+    _width = width;
+    _height = height;
+    // The real frame memory holds random data after reset, black makes the snapshots easier to read
+    _memory = (uint16_t *)calloc(width * height, sizeof(uint16_t));
+    _sleeping = false;
+}
+
+void Panel_ILI9341::beginTransaction(void) {
+    _stats.transactions++;
+}
+
+void Panel_ILI9341::writeCommand(uint8_t command, const uint8_t *data, uint32_t length) {
+    _stats.commands++;
+    _stats.bytes += 1 + length;
+}
+
+void Panel_ILI9341::setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+    uint8_t caset[4] = {(uint8_t)(x0 >> 8), (uint8_t)x0, (uint8_t)(x1 >> 8), (uint8_t)x1};
+    uint8_t paset[4] = {(uint8_t)(y0 >> 8), (uint8_t)y0, (uint8_t)(y1 >> 8), (uint8_t)y1};
+    writeCommand(ILI9341_CASET, caset, sizeof(caset));
+    writeCommand(ILI9341_PASET, paset, sizeof(paset));
+    writeCommand(ILI9341_RAMWR, NULL, 0);
+    _win_x0 = x0;
+    _win_y0 = y0;
+    _win_x1 = x1;
+    _win_y1 = y1;
+    _cursor_x = x0;
+    _cursor_y = y0;
+}
+
+void Panel_ILI9341::writePixel(uint16_t rgb565) {
+    if (_cursor_x >= 0 && _cursor_x < _width && _cursor_y >= 0 && _cursor_y < _height)
+        _memory[_cursor_y * _width + _cursor_x] = rgb565;
+    // Like the controller, wrap around within the window
+    if (++_cursor_x > _win_x1) {
+        _cursor_x = _win_x0;
+        if (++_cursor_y > _win_y1)
+            _cursor_y = _win_y0;
+    }
+}
+
+void Panel_ILI9341::writeColor(uint16_t rgb565, uint32_t length) {
+    _stats.pixels += length;
+    _stats.bytes += length * 2;
+    while (length--) writePixel(rgb565);
+}
+
+void Panel_ILI9341::writePixels(const swap565_t *data, uint32_t length) {
+    _stats.pixels += length;
+    _stats.bytes += length * 2;
+    for (uint32_t i = 0; i < length; i++) writePixel(__builtin_bswap16(data[i].raw));
+}
+
+void Panel_ILI9341::setSleep(bool sleep) {
+    writeCommand(sleep ? ILI9341_SLPIN : ILI9341_SLPOUT, NULL, 0);
+    _sleeping = sleep;
+}
+
+bool Panel_ILI9341::writePPM(const char *path) const {
+    FILE *file = fopen(path, "wb");
+    if (file == NULL)
+        return false;
+    fprintf(file, "P6\n%d %d\n255\n", (int)_width, (int)_height);
+    for (int32_t p = 0; p < _width * _height; p++) {
+        uint32_t rgb888 = LovyanGFX::color888(_memory[p]);
+        uint8_t rgb[3] = {(uint8_t)(rgb888 >> 16), (uint8_t)(rgb888 >> 8), (uint8_t)rgb888};
+        fwrite(rgb, 1, sizeof(rgb), file);
+    }
+    fclose(file);
+    return true;
+}
+
+bool LovyanGFX::clip(int32_t *x, int32_t *y, int32_t *w, int32_t *h) {
+    int32_t x0 = std::max(std::max(*x, _clip_l), (int32_t)0);
+    int32_t y0 = std::max(std::max(*y, _clip_t), (int32_t)0);
+    int32_t x1 = std::min(std::min(*x + *w, _clip_r), _width);
+    int32_t y1 = std::min(std::min(*y + *h, _clip_b), _height);
+    if (x1 <= x0 || y1 <= y0)
+        return false;
+    *x = x0;
+    *y = y0;
+    *w = x1 - x0;
+    *h = y1 - y0;
+    return true;
+}
+
+void LovyanGFX::setClipRect(int32_t x, int32_t y, int32_t w, int32_t h) {
+    _clip_l = x;
+    _clip_t = y;
+    _clip_r = x + w;
+    _clip_b = y + h;
+}
+
+void LovyanGFX::clearClipRect(void) {
+    _clip_l = 0;
+    _clip_t = 0;
+    _clip_r = INT32_MAX;
+    _clip_b = INT32_MAX;
+}
+
+void LovyanGFX::writeFillRect(int32_t x, int32_t y, int32_t w, int32_t h) {
+    if (clip(&x, &y, &w, &h))
+        fillRectImpl(x, y, w, h, _color);
+}
+
+void LovyanGFX::fillRect(int32_t x, int32_t y, int32_t w, int32_t h) {
+    startWrite();
+    writeFillRect(x, y, w, h);
+    endWrite();
+}
+
+void LovyanGFX::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const swap565_t *data) {
+    int32_t cx = x, cy = y, cw = w, ch = h;
+    if (!clip(&cx, &cy, &cw, &ch))
+        return;
+    startWrite();
+    pushImageImpl(cx, cy, cw, ch, data + (cy - y) * w + (cx - x), w);
+    endWrite();
+}
+
+void LovyanGFX::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const void *data, color_depth_t depth,
+                          const RGBColor *palette) {
+    if (depth != palette_4bit || palette == nullptr) {
+        fprintf(stderr, "pushImage: colour depth %d is not supported\n", (int)depth);
+        abort();
+    }
+    int32_t cx = x, cy = y, cw = w, ch = h;
+    if (!clip(&cx, &cy, &cw, &ch))
+        return;
+    // Expanded through the palette into a temporary RGB565 image, as LovyanGFX does line by line
+    const uint8_t *indices = (const uint8_t *)data;
+    int32_t stride = (w + 1) / 2;
+    swap565_t *pixels = (swap565_t *)malloc(cw * ch * sizeof(swap565_t));
+    for (int32_t row = 0; row < ch; row++) {
+        for (int32_t col = 0; col < cw; col++) {
+            int32_t px = cx - x + col;
+            uint8_t byte = indices[(cy - y + row) * stride + px / 2];
+            const RGBColor &color = palette[(px & 1) ? (byte & 0x0F) : (byte >> 4)];
+            pixels[row * cw + col].raw = __builtin_bswap16(color565(color.r, color.g, color.b));
+        }
+    }
+    startWrite();
+    pushImageImpl(cx, cy, cw, ch, pixels, cw);
+    endWrite();
+    free(pixels);
+}
+
+bool LGFX_Device::init(void) {
+    auto cfg = _panel->config();
+    // Rotation 0 plus the offset rotation of the configuration: odd values are landscape
+    bool landscape = (cfg.offset_rotation & 1);
+    _width = landscape ? cfg.panel_height : cfg.panel_width;
+    _height = landscape ? cfg.panel_width : cfg.panel_height;
+    _panel->init(_width, _height);
+    return true;
+}
+
+void LGFX_Device::startWrite(void) {
+    if (_transaction_count++ == 0)
+        _panel->beginTransaction();
+}
+
+void LGFX_Device::endWrite(void) {
+    if (_transaction_count > 0)
+        _transaction_count--;
+}
+
+void LGFX_Device::sleep(void) {
+    startWrite();
+    _panel->setSleep(true);
+    endWrite();
+}
+
+void LGFX_Device::wakeup(void) {
+    startWrite();
+    _panel->setSleep(false);
+    endWrite();
+}
+
+void LGFX_Device::fillRectImpl(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t rgb565) {
+    _panel->setWindow(x, y, x + w - 1, y + h - 1);
+    _panel->writeColor(rgb565, w * h);
+}
+
+void LGFX_Device::pushImageImpl(int32_t x, int32_t y, int32_t w, int32_t h, const swap565_t *data, int32_t stride) {
+    _panel->setWindow(x, y, x + w - 1, y + h - 1);
+    for (int32_t row = 0; row < h; row++) {
+        _panel->writePixels(data + row * stride, w);
+    }
+}
+
+LGFX_Sprite::~LGFX_Sprite(void) {
+    deleteSprite();
+}
+
+void LGFX_Sprite::setColorDepth(int depth) {
+    if (depth != 4 && depth != 16) {
+        fprintf(stderr, "setColorDepth: %d bit sprites are not supported\n", depth);
+        abort();
+    }
+    _depth = (depth == 4) ? palette_4bit : rgb565_2Byte;
+}
+
+void *LGFX_Sprite::createSprite(int32_t w, int32_t h) {
+    deleteSprite();
+    size_t size = (_depth == palette_4bit) ? (w + 1) / 2 * h : w * h * sizeof(swap565_t);
+    _buffer = heap_caps_malloc(size, MALLOC_CAP_DMA);
+    if (_buffer == nullptr)
+        return nullptr;
+    _width = w;
+    _height = h;
+    return _buffer;
+}
+
+void LGFX_Sprite::deleteSprite(void) {
+    heap_caps_free(_buffer);
+    _buffer = nullptr;
+    _width = 0;
+    _height = 0;
+    _palette = false;
+}
+
+bool LGFX_Sprite::createPalette(const uint16_t *colors, uint32_t count) {
+    if (_depth != palette_4bit || count > 16)
+        return false;
+    for (uint32_t i = 0; i < count; i++) {
+        uint32_t rgb888 = color888(colors[i]);
+        _palette_colors[i] = {(uint8_t)rgb888, (uint8_t)(rgb888 >> 8), (uint8_t)(rgb888 >> 16)};
+    }
+    _palette = true;
+    return true;
+}
+
+void LGFX_Sprite::fillRectImpl(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) {
+    if (_depth == palette_4bit) {
+        uint8_t *indices = (uint8_t *)_buffer;
+        int32_t stride = (_width + 1) / 2;
+        for (int32_t row = y; row < y + h; row++) {
+            for (int32_t col = x; col < x + w; col++) {
+                uint8_t *byte = &indices[row * stride + col / 2];
+                *byte = (col & 1) ? ((*byte & 0xF0) | (color & 0x0F)) : ((*byte & 0x0F) | (color << 4));
+            }
+        }
+        return;
+    }
+    swap565_t *pixels = (swap565_t *)_buffer;
+    swap565_t rgb565 = {__builtin_bswap16(color)};
+    for (int32_t row = y; row < y + h; row++) {
+        std::fill(pixels + row * _width + x, pixels + row * _width + x + w, rgb565);
+    }
+}
+
+void LGFX_Sprite::pushImageImpl(int32_t x, int32_t y, int32_t w, int32_t h, const swap565_t *data, int32_t stride) {
+    if (_depth == palette_4bit) {
+        // LovyanGFX would map the colours to palette indices, Display never does this
+        fprintf(stderr, "pushImage: RGB565 images cannot be pushed into a palette sprite\n");
+        abort();
+    }
+    swap565_t *pixels = (swap565_t *)_buffer;
+    for (int32_t row = 0; row < h; row++) {
+        memcpy(pixels + (y + row) * _width + x, data + row * stride, w * sizeof(swap565_t));
+    }
+}
+
+}  // namespace lgfx
@@ -0,0 +1,238 @@
+// FreeRTOS, ESP-IDF drivers and heap on top of the C++ standard library
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <string.h>
+#include <thread>
+#include <vector>
+#include "freertos/FreeRTOS.h"
+#include "driver/ledc.h"
+#include "esp_adc/adc_oneshot.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "host_emulator.hpp"
+
+esp_log_level_t host_log_level = ESP_LOG_WARN;
+uint16_t host_ambient_light = 70;
+size_t host_free_heap = 300 * 1024;
+
+// A single lock for everything: simple and good enough for a handful of tasks. The tasks never end, so none of
+// this may be destroyed when main returns
+static std::mutex &rtos_mutex = *new std::mutex;
+static std::condition_variable &rtos_changed = *new std::condition_variable;
+
+struct host_task_t {
+    TaskFunction_t function;
+    void *parameters;
+    uint32_t notification_value = 0;  // Counter or bits, as in FreeRTOS
+    bool notified = false;            // A notification is pending
+    bool blocked = false;  // Waiting for a notification or a queue item which is not there yet
+};
+
+struct host_queue_t {
+    size_t length;
+    size_t item_size;
+    std::deque<std::vector<uint8_t>> items;
+};
+
+static std::list<host_task_t> &tasks = *new std::list<host_task_t>;
+static thread_local host_task_t *current_task = NULL;
+
+static std::chrono::steady_clock::time_point timeout(TickType_t ticks) {
+    if (ticks == portMAX_DELAY)
+        return std::chrono::steady_clock::time_point::max();
+    return std::chrono::steady_clock::now() + std::chrono::milliseconds(ticks * portTICK_PERIOD_MS);
+}
+
+// Waits until the condition is met or the timeout expires, marking the calling task as blocked meanwhile
+template <typename Predicate>
+static bool blockUntil(std::unique_lock<std::mutex> &lock, TickType_t ticks, Predicate condition) {
+    if (condition())
+        return true;
+    if (ticks == 0)
+        return false;
+    if (current_task != NULL)
+        current_task->blocked = true;
+    rtos_changed.notify_all();
+    bool met;
+    if (ticks == portMAX_DELAY) {
+        rtos_changed.wait(lock, condition);
+        met = true;
+    } else {
+        met = rtos_changed.wait_until(lock, timeout(ticks), condition);
+    }
+    if (current_task != NULL)
+        current_task->blocked = false;
+    return met;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t function, const char *name, uint32_t stack_depth, void *parameters,
+                       UBaseType_t priority, TaskHandle_t *created_task) {
+    host_task_t *task;
+    {
+        std::lock_guard<std::mutex> lock(rtos_mutex);
+        tasks.push_back(host_task_t{function, parameters});
+        task = &tasks.back();
+    }
+    if (created_task != NULL)
+        *created_task = task;
+    std::thread([task]() {
+        current_task = task;
+        task->function(task->parameters);
+    }).detach();
+    return pdPASS;
+}
+
+void vTaskDelay(TickType_t ticks) {
+    std::unique_lock<std::mutex> lock(rtos_mutex);
+    blockUntil(lock, ticks, []() { return false; });
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+    std::lock_guard<std::mutex> lock(rtos_mutex);
+    task->notification_value++;
+    task->notified = true;
+    rtos_changed.notify_all();
+    return pdPASS;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear_count_on_exit, TickType_t ticks_to_wait) {
+    std::unique_lock<std::mutex> lock(rtos_mutex);
+    host_task_t *task = current_task;
+    if (!blockUntil(lock, ticks_to_wait, [task]() { return task->notification_value > 0; }))
+        return 0;
+    uint32_t value = task->notification_value;
+    task->notification_value = clear_count_on_exit ? 0 : value - 1;
+    task->notified = false;
+    return value;
+}
+
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action) {
+    std::lock_guard<std::mutex> lock(rtos_mutex);
+    task->notification_value |= value;
+    task->notified = true;
+    rtos_changed.notify_all();
+    return pdPASS;
+}
+
+BaseType_t xTaskNotifyWait(uint32_t bits_to_clear_on_entry, uint32_t bits_to_clear_on_exit, uint32_t *notification_value,
+                           TickType_t ticks_to_wait) {
+    std::unique_lock<std::mutex> lock(rtos_mutex);
+    host_task_t *task = current_task;
+    if (!task->notified)
+        task->notification_value &= ~bits_to_clear_on_entry;
+    if (!blockUntil(lock, ticks_to_wait, [task]() { return task->notified; }))
+        return pdFALSE;
+    if (notification_value != NULL)
+        *notification_value = task->notification_value;
+    task->notification_value &= ~bits_to_clear_on_exit;
+    task->notified = false;
+    return pdTRUE;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size) {
+    host_queue_t *queue = new host_queue_t;
+    queue->length = length;
+    queue->item_size = item_size;
+    return queue;
+}
+
+BaseType_t xQueueSend(QueueHandle_t queue, const void *item, TickType_t ticks_to_wait) {
+    std::unique_lock<std::mutex> lock(rtos_mutex);
+    if (!blockUntil(lock, ticks_to_wait, [queue]() { return queue->items.size() < queue->length; }))
+        return pdFALSE;
+    const uint8_t *bytes = static_cast<const uint8_t *>(item);
+    queue->items.emplace_back(bytes, bytes + queue->item_size);
+    rtos_changed.notify_all();
+    return pdPASS;
+}
+
+BaseType_t xQueueReceive(QueueHandle_t queue, void *buffer, TickType_t ticks_to_wait) {
+    std::unique_lock<std::mutex> lock(rtos_mutex);
+    if (!blockUntil(lock, ticks_to_wait, [queue]() { return !queue->items.empty(); }))
+        return pdFALSE;
+    memcpy(buffer, queue->items.front().data(), queue->item_size);
+    queue->items.pop_front();
+    rtos_changed.notify_all();
+    return pdPASS;
+}
+
+void host_wait_idle(void) {
+    std::unique_lock<std::mutex> lock(rtos_mutex);
+    rtos_changed.wait(lock, []() {
+        for (const host_task_t &task : tasks) {
+            if (!task.blocked || task.notified)
+                return false;
+        }
+        return true;
+    });
+}
+
+int64_t esp_timer_get_time(void) {
+    static const auto start = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+size_t heap_caps_get_free_size(uint32_t caps) {
+    return host_free_heap;
+}
+
+void *heap_caps_malloc(size_t size, uint32_t caps) {
+    if (size > host_free_heap)
+        return NULL;
+    host_free_heap -= size;
+    return malloc(size);
+}
+
+void heap_caps_free(void *ptr) {
+    free(ptr);
+}
+
+static uint32_t backlight_duty = 0;
+
+esp_err_t ledc_timer_config(const ledc_timer_config_t *timer_conf) {
+    return ESP_OK;
+}
+
+esp_err_t ledc_channel_config(const ledc_channel_config_t *ledc_conf) {
+    backlight_duty = ledc_conf->duty;
+    return ESP_OK;
+}
+
+esp_err_t ledc_fade_func_install(int intr_alloc_flags) {
+    return ESP_OK;
+}
+
+esp_err_t ledc_fade_stop(ledc_mode_t speed_mode, ledc_channel_t channel) {
+    return ESP_OK;
+}
+
+esp_err_t ledc_set_fade_time_and_start(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t target_duty,
+                                       uint32_t max_fade_time_ms, ledc_fade_mode_t fade_mode) {
+    backlight_duty = target_duty;
+    return ESP_OK;
+}
+
+uint32_t ledc_get_duty(ledc_mode_t speed_mode, ledc_channel_t channel) {
+    return backlight_duty;
+}
+
+uint32_t host_backlight_duty(void) {
+    return backlight_duty;
+}
+
+esp_err_t adc_oneshot_new_unit(const adc_oneshot_unit_init_cfg_t *init_config, adc_oneshot_unit_handle_t *ret_unit) {
+    *ret_unit = NULL;
+    return ESP_OK;
+}
+
+esp_err_t adc_oneshot_config_channel(adc_oneshot_unit_handle_t handle, adc_channel_t channel,
+                                     const adc_oneshot_chan_cfg_t *config) {
+    return ESP_OK;
+}
+
+esp_err_t adc_oneshot_read(adc_oneshot_unit_handle_t handle, adc_channel_t chan, int *out_raw) {
+    *out_raw = host_ambient_light;
+    return ESP_OK;
+}
@@ -0,0 +1,286 @@
+// Host stand-in for the subset of LovyanGFX used by Display. The drawing primitives behave like the LovyanGFX ones,
+// but instead of talking to a real SPI bus the device sends its commands to an emulated ILI9341 controller, which
+// keeps the frame memory and counts every command, pixel and byte (see Panel_ILI9341)
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define PROGMEM
+#define SPI_DMA_CH_AUTO 3
+
+typedef enum : uint8_t {
+    top_left = 0,
+    top_center = 1,
+    top_right = 2,
+    middle_left = 4,
+    middle_center = 5,
+    middle_right = 6,
+    bottom_left = 8,
+    bottom_center = 9,
+    bottom_right = 10,
+    baseline_left = 16,
+    baseline_center = 17,
+    baseline_right = 18,
+} textdatum_t;
+
+// RGB565, as in LovyanGFX
+static constexpr int TFT_BLACK = 0x0000;
+static constexpr int TFT_DARKGRAY = 0x7BEF;
+static constexpr int TFT_LIGHTGRAY = 0xD69A;
+static constexpr int TFT_RED = 0xF800;
+static constexpr int TFT_ORANGE = 0xFDA0;
+static constexpr int TFT_YELLOW = 0xFFE0;
+static constexpr int TFT_WHITE = 0xFFFF;
+
+namespace lgfx {
+
+// RGB565 with the bytes in the order they are sent to the panel
+struct swap565_t {
+    uint16_t raw;
+};
+
+// Palette entry, as in LovyanGFX
+struct bgr888_t {
+    uint8_t b;
+    uint8_t g;
+    uint8_t r;
+};
+typedef bgr888_t RGBColor;
+
+// Only the formats used by Display
+enum color_depth_t : uint16_t {
+    has_palette = 0x0800,
+    palette_4bit = 4 | has_palette,
+    rgb565_2Byte = 16 | 2 << 8,
+};
+
+struct TextStyle {
+    uint32_t fore_rgb888 = 0xFFFFFF;
+    uint32_t back_rgb888 = 0;
+    textdatum_t datum = top_left;
+};
+
+// Counters of everything sent to the panel
+struct panel_stats_t {
+    uint32_t transactions;  // Bus acquisitions (startWrite from idle)
+    uint32_t commands;      // Command bytes (CASET, PASET, RAMWR, SLPIN, ...)
+    uint32_t pixels;        // Pixels written to the frame memory
+    uint32_t bytes;         // All bytes sent over SPI: commands, parameters and pixel data
+};
+
+class Bus_SPI {
+   public:
+    struct config_t {
+        int spi_host = 0;
+        uint8_t spi_mode = 0;
+        uint32_t freq_write = 0;
+        uint32_t freq_read = 0;
+        bool spi_3wire = false;
+        bool use_lock = false;
+        int dma_channel = 0;
+        int pin_sclk = -1;
+        int pin_mosi = -1;
+        int pin_miso = -1;
+        int pin_dc = -1;
+    };
+    config_t config(void) const { return _cfg; }
+    void config(const config_t &cfg) { _cfg = cfg; }
+
+   private:
+    config_t _cfg;
+};
+
+// Emulated ILI9341: a frame memory in the orientation used by the clock (landscape, 320x240) plus the window set
+// with CASET/PASET, into which the pixel data following RAMWR is written
+class Panel_ILI9341 {
+   public:
+    struct config_t {
+        int pin_cs = -1;
+        int pin_rst = -1;
+        int pin_busy = -1;
+        uint16_t memory_width = 240;
+        uint16_t memory_height = 320;
+        uint16_t panel_width = 240;
+        uint16_t panel_height = 320;
+        uint16_t offset_x = 0;
+        uint16_t offset_y = 0;
+        uint8_t offset_rotation = 0;
+        uint8_t dummy_read_pixel = 8;
+        uint8_t dummy_read_bits = 1;
+        bool readable = true;
+        bool invert = false;
+        bool rgb_order = false;
+        bool dlen_16bit = false;
+        bool bus_shared = false;
+    };
+
+    Panel_ILI9341(void);
+    config_t config(void) const { return _cfg; }
+    void config(const config_t &cfg) { _cfg = cfg; }
+    void setBus(Bus_SPI *bus) { _bus = bus; }
+
+    void init(int32_t width, int32_t height);
+    int32_t width(void) const { return _width; }
+    int32_t height(void) const { return _height; }
+    void beginTransaction(void);
+    void writeCommand(uint8_t command, const uint8_t *data, uint32_t length);
+    void setWindow(int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+    void writeColor(uint16_t rgb565, uint32_t length);
+    void writePixels(const swap565_t *data, uint32_t length);
+    void setSleep(bool sleep);
+
+    bool isSleeping(void) const { return _sleeping; }
+    uint16_t readPixel(int32_t x, int32_t y) const { return _memory[y * _width + x]; }
+    const panel_stats_t &getStats(void) const { return _stats; }
+    bool writePPM(const char *path) const;
+
+   private:
+    config_t _cfg;
+    Bus_SPI *_bus = nullptr;
+    uint16_t *_memory = nullptr;
+    int32_t _width = 0;
+    int32_t _height = 0;
+    int32_t _win_x0 = 0, _win_y0 = 0, _win_x1 = 0, _win_y1 = 0;
+    int32_t _cursor_x = 0, _cursor_y = 0;
+    bool _sleeping = false;
+    panel_stats_t _stats = {};
+
+    void writePixel(uint16_t rgb565);
+};
+
+// Panel of the display instance, so that the emulator can reach it although it is private to Display
+extern Panel_ILI9341 *host_panel;
+
+class LovyanGFX {
+   public:
+    virtual ~LovyanGFX(void) {}
+
+    int32_t width(void) const { return _width; }
+    int32_t height(void) const { return _height; }
+    void setRotation(int rotation) {}
+    void setColorDepth(int depth) {}
+
+    static constexpr uint16_t color565(uint8_t r, uint8_t g, uint8_t b) {
+        return (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+    }
+    static constexpr uint32_t color888(uint16_t rgb565) {
+        // Same expansion as LovyanGFX: the upper bits are repeated in the lower ones
+        return ((uint32_t)(((rgb565 >> 8) & 0xF8) | ((rgb565 >> 13) & 0x07)) << 16) |
+               ((uint32_t)(((rgb565 >> 3) & 0xFC) | ((rgb565 >> 9) & 0x03)) << 8) |
+               (uint32_t)(((rgb565 << 3) & 0xF8) | ((rgb565 >> 2) & 0x07));
+    }
+    static constexpr uint32_t color16to24(uint16_t rgb565) { return color888(rgb565); }
+    static constexpr uint16_t color24to16(uint32_t rgb888) { return color565(rgb888 >> 16, rgb888 >> 8, rgb888); }
+
+    // As in LovyanGFX, a 32 bit colour is RGB888, anything else RGB565. Canvases with a palette take the index
+    void setColor(uint32_t rgb888) { _color = _palette ? (rgb888 & 0x0F) : color565(rgb888 >> 16, rgb888 >> 8, rgb888); }
+    void setColor(int rgb565) { _color = _palette ? (rgb565 & 0x0F) : (uint16_t)rgb565; }
+    void setColor(uint16_t rgb565) { _color = _palette ? (rgb565 & 0x0F) : rgb565; }
+
+    void setTextColor(int fore_rgb565, int back_rgb565) {
+        _text_style.fore_rgb888 = color888(fore_rgb565);
+        _text_style.back_rgb888 = color888(back_rgb565);
+    }
+    void setTextDatum(uint8_t datum) { _text_style.datum = (textdatum_t)datum; }
+    textdatum_t getTextDatum(void) const { return _text_style.datum; }
+    const TextStyle &getTextStyle(void) const { return _text_style; }
+    void setTextStyle(const TextStyle &style) { _text_style = style; }
+
+    virtual void startWrite(void) {}
+    virtual void endWrite(void) {}
+
+    void setClipRect(int32_t x, int32_t y, int32_t w, int32_t h);
+    void clearClipRect(void);
+
+    void writeFillRect(int32_t x, int32_t y, int32_t w, int32_t h);
+    void writeFastHLine(int32_t x, int32_t y, int32_t w) { writeFillRect(x, y, w, 1); }
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h);
+    template <typename T>
+    void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, const T &color) {
+        setColor(color);
+        fillRect(x, y, w, h);
+    }
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const swap565_t *data);
+    // Image in another format, expanded to RGB565 on the fly. Only 4 bpp with palette is supported
+    void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const void *data, color_depth_t depth,
+                   const RGBColor *palette);
+
+   protected:
+    int32_t _width = 0;
+    int32_t _height = 0;
+    uint16_t _color = 0xFFFF;  // RGB565, or the palette index
+    bool _palette = false;
+    TextStyle _text_style;
+
+    // Primitives of the actual target, already clipped. The image rows are stride pixels apart
+    virtual void fillRectImpl(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t rgb565) = 0;
+    virtual void pushImageImpl(int32_t x, int32_t y, int32_t w, int32_t h, const swap565_t *data,
+                               int32_t stride) = 0;
+
+   private:
+    int32_t _clip_l = 0;
+    int32_t _clip_t = 0;
+    int32_t _clip_r = INT32_MAX;
+    int32_t _clip_b = INT32_MAX;
+
+    bool clip(int32_t *x, int32_t *y, int32_t *w, int32_t *h);
+};
+
+class LGFX_Device : public LovyanGFX {
+   public:
+    void setPanel(Panel_ILI9341 *panel) { _panel = panel; }
+    bool init(void);
+    void initDMA(void) {}
+    void waitDMA(void) {}
+    bool dmaBusy(void) const { return false; }
+    void startWrite(void) override;
+    void endWrite(void) override;
+    void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, const swap565_t *data) {
+        pushImage(x, y, w, h, data);
+    }
+    void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, const void *data, color_depth_t depth,
+                      const RGBColor *palette) {
+        pushImage(x, y, w, h, data, depth, palette);
+    }
+    void sleep(void);
+    void wakeup(void);
+
+   protected:
+    void fillRectImpl(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t rgb565) override;
+    void pushImageImpl(int32_t x, int32_t y, int32_t w, int32_t h, const swap565_t *data, int32_t stride) override;
+
+   private:
+    Panel_ILI9341 *_panel = nullptr;
+    uint32_t _transaction_count = 0;
+};
+
+// Sprite in RAM, either 16 bit stored byte swapped or 4 bit palette indices (the left pixel in the upper nibble),
+// like in LovyanGFX. The colour depth has to be set before createSprite
+class LGFX_Sprite : public LovyanGFX {
+   public:
+    LGFX_Sprite(LovyanGFX *parent) {}
+    ~LGFX_Sprite(void) override;
+    void setColorDepth(int depth);
+    color_depth_t getColorDepth(void) const { return _depth; }
+    void *createSprite(int32_t w, int32_t h);
+    void deleteSprite(void);
+    bool createPalette(const uint16_t *colors, uint32_t count);
+    RGBColor *getPalette(void) const { return _palette ? (RGBColor *)_palette_colors : nullptr; }
+    void *getBuffer(void) const { return _buffer; }
+    template <typename T>
+    void fillSprite(const T &color) {
+        fillRect(0, 0, _width, _height, color);
+    }
+
+   protected:
+    void fillRectImpl(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t color) override;
+    void pushImageImpl(int32_t x, int32_t y, int32_t w, int32_t h, const swap565_t *data, int32_t stride) override;
+
+   private:
+    color_depth_t _depth = rgb565_2Byte;
+    void *_buffer = nullptr;
+    RGBColor _palette_colors[16] = {};
+};
+
+}  // namespace lgfx
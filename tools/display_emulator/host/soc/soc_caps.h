@@ -0,0 +1,4 @@
+// Host stand-in for the SoC capabilities of the ESP32-C3
+#pragma once
+
+#define SOC_LEDC_SUPPORT_FADE_STOP 1
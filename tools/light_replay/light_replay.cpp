@@ -0,0 +1,102 @@
+/*
+Runs the ambient light pipeline of the clock (AmbientLight, see src/ambient_light.hpp) on Linux with a recorded light
+trace and prints what it makes of it: filtered value, lux, backlight brightness, dark and night.
+
+A trace is a text file with one block of raw ADC samples per line, preceded by the time in milliseconds when it was
+taken. Lines starting with # are comments:
+    # time_ms samples...
+    0 70 71 69 70
+    1000 70 70 72 69
+*/
+
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <ambient_light.hpp>
+
+// Reads the next block of the trace. Returns false at the end of the file
+static bool readBlock(FILE *file, int64_t *time_ms, std::vector<uint16_t> *samples) {
+    char line[8192];
+    while (fgets(line, sizeof(line), file) != NULL) {
+        char *next = line;
+        while (*next == ' ' || *next == '\t')
+            next++;
+        if (*next == '#' || *next == '\n' || *next == '\0')
+            continue;
+        *time_ms = strtoll(next, &next, 10);
+        samples->clear();
+        while (1) {
+            char *end;
+            long sample = strtol(next, &end, 10);
+            if (end == next)
+                break;
+            samples->push_back((uint16_t)sample);
+            next = end;
+        }
+        return true;
+    }
+    return false;
+}
+
+static void printState(int64_t time_ms, const light_state_t *state) {
+    printf("%10lld %8.2f %8u %6u %5s %5s %7s\n", (long long)time_ms, state->filtered_q8 / 256.0,
+           state->lux_milli, state->brightness, state->dark ? "yes" : "no", state->night ? "yes" : "no",
+           state->settled ? "yes" : "no");
+}
+
+static void usage(const char *program) {
+    fprintf(stderr, "Usage: %s [-v] trace\n", program);
+    fprintf(stderr, "  -v  print every block, not only the changes\n");
+}
+
+int main(int argc, char *argv[]) {
+    bool verbose = false;
+    int option;
+    while ((option = getopt(argc, argv, "vh")) != -1) {
+        switch (option) {
+            case 'v':
+                verbose = true;
+                break;
+            default:
+                usage(argv[0]);
+                return 1;
+        }
+    }
+    if (optind != argc - 1) {
+        usage(argv[0]);
+        return 1;
+    }
+    FILE *file = fopen(argv[optind], "r");
+    if (file == NULL) {
+        fprintf(stderr, "Could not open %s\n", argv[optind]);
+        return 1;
+    }
+
+    AmbientLight light;
+    const light_state_t *state = light.getState();
+    std::vector<uint16_t> samples;
+    int64_t time_ms;
+    uint32_t wakeups = 0;
+    uint32_t changes = 0;
+    int64_t max_latency_us = 0;
+
+    printf("%10s %8s %8s %6s %5s %5s %7s\n", "time_ms", "filtered", "mlux", "bright", "dark", "night", "settled");
+    while (readBlock(file, &time_ms, &samples)) {
+        wakeups++;
+        bool was_settled = state->settled;
+        bool changed = light.addBlock(samples.data(), samples.size(), time_ms * 1000);
+        if (changed)
+            changes++;
+        if (verbose || changed)
+            printState(time_ms, state);
+        if (!was_settled && state->settled && state->latency_us > max_latency_us)
+            max_latency_us = state->latency_us;
+    }
+    fclose(file);
+
+    printf("%u blocks accepted, %u outliers, %u changes, %u wake-ups, longest time to settle %lld ms\n",
+           state->blocks, state->outliers, changes, wakeups, (long long)(max_latency_us / 1000));
+    return 0;
+}
@@ -0,0 +1,178 @@
+#!/usr/bin/env python3
+"""
+Turns a screen snapshot sent by the clock over the serial console back into an image.
+
+The clock sends a snapshot when "snapshot" is typed on the serial monitor (see src/serial_console.cpp). Its lines are
+mixed with the logs, so the input can be a log file, stdin or, with -p, the serial port itself. The last complete
+snapshot of the input is written as PNG or PPM, depending on the extension of the output file.
+"""
+
+import argparse
+import base64
+import binascii
+import struct
+import sys
+import zlib
+
+MISSING_COLOR = (255, 0, 255)  # Rows which are missing or damaged
+
+
+def rgb565_to_rgb(color):
+    r = (color >> 11) & 0x1F
+    g = (color >> 5) & 0x3F
+    b = color & 0x1F
+    return ((r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2))
+
+
+def decode_row(data, width):
+    """Runs of (length - 1, RGB565 big endian) into a list of RGB565 pixels"""
+    runs = base64.b64decode(data, validate=True)
+    if len(runs) % 3:
+        raise ValueError("truncated run")
+    pixels = []
+    for offset in range(0, len(runs), 3):
+        length, color = struct.unpack(">BH", runs[offset:offset + 3])
+        pixels.extend([color] * (length + 1))
+    if len(pixels) != width:
+        raise ValueError("%d pixels instead of %d" % (len(pixels), width))
+    return pixels
+
+
+class Snapshot:
+    def __init__(self, nr, width, height):
+        self.nr = nr
+        self.width = width
+        self.height = height
+        self.rows = [None] * height
+        self.errors = []
+        self.complete = False
+
+    def add_row(self, y, crc, data):
+        if not 0 <= y < self.height:
+            self.errors.append("row %d is out of the screen" % y)
+            return
+        try:
+            if data == "=":
+                if y == 0 or self.rows[y - 1] is None:
+                    raise ValueError("repeats a missing row")
+                pixels = list(self.rows[y - 1])
+            else:
+                pixels = decode_row(data, self.width)
+        except (ValueError, binascii.Error) as error:
+            self.errors.append("row %d: %s" % (y, error))
+            return
+        if binascii.crc_hqx(struct.pack(">%dH" % self.width, *pixels), 0xFFFF) != crc:
+            self.errors.append("row %d: wrong CRC" % y)
+            return
+        self.rows[y] = pixels
+
+    def rgb_rows(self):
+        for pixels in self.rows:
+            if pixels is None:
+                yield bytes(MISSING_COLOR) * self.width
+            else:
+                yield b"".join(bytes(rgb565_to_rgb(color)) for color in pixels)
+
+
+def parse(lines):
+    """Returns the last snapshot found in the lines, None if there is none"""
+    current = None
+    last = None
+    for line in lines:
+        # The line may be preceded by the rest of a log line, or have a colour code of the monitor around it
+        start = line.find("SNAP ")
+        if start < 0:
+            continue
+        fields = line[start:].strip().split()
+        try:
+            if fields[1] == "BEGIN":
+                current = Snapshot(int(fields[2]), int(fields[3]), int(fields[4]))
+                last = current
+            elif fields[1] == "FAIL":
+                print("Snapshot %s failed: %s" % (fields[2], " ".join(fields[3:])), file=sys.stderr)
+                current = None
+            elif current is None:
+                continue
+            elif fields[1] == "END":
+                current.complete = int(fields[2]) == current.nr
+                current = None
+            elif int(fields[1]) == current.nr:
+                current.add_row(int(fields[2]), int(fields[3], 16), fields[4])
+        except (IndexError, ValueError):
+            if current is not None:
+                current.errors.append("unreadable line: %s" % line.strip())
+    return last
+
+
+def write_ppm(snapshot, path):
+    with open(path, "wb") as file:
+        file.write(b"P6\n%d %d\n255\n" % (snapshot.width, snapshot.height))
+        for row in snapshot.rgb_rows():
+            file.write(row)
+
+
+def write_png(snapshot, path):
+    def chunk(kind, data):
+        return (struct.pack(">I", len(data)) + kind + data +
+                struct.pack(">I", zlib.crc32(kind + data) & 0xFFFFFFFF))
+
+    raw = b"".join(b"\x00" + row for row in snapshot.rgb_rows())
+    with open(path, "wb") as file:
+        file.write(b"\x89PNG\r\n\x1a\n")
+        file.write(chunk(b"IHDR", struct.pack(">IIBBBBB", snapshot.width, snapshot.height, 8, 2, 0, 0, 0)))
+        file.write(chunk(b"IDAT", zlib.compress(raw, 9)))
+        file.write(chunk(b"IEND", b""))
+
+
+def read_port(port, baudrate, timeout):
+    import serial  # pyserial, only needed for -p
+
+    with serial.Serial(port, baudrate, timeout=timeout) as connection:
+        connection.write(b"snapshot\r")
+        while True:
+            line = connection.readline()
+            if not line:
+                raise SystemExit("No answer from the clock within %d s" % timeout)
+            line = line.decode("ascii", errors="replace")
+            yield line
+            if "SNAP END" in line or "SNAP FAIL" in line:
+                return
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("output", help="image to write, .png or .ppm")
+    parser.add_argument("log", nargs="?", help="log with the snapshot, stdin if missing")
+    parser.add_argument("-p", "--port", help="ask the clock on this serial port for a snapshot (needs pyserial)")
+    parser.add_argument("-b", "--baudrate", type=int, default=115200)
+    parser.add_argument("-t", "--timeout", type=int, default=10, help="seconds to wait for every line with -p")
+    args = parser.parse_args()
+
+    if args.port:
+        snapshot = parse(read_port(args.port, args.baudrate, args.timeout))
+    elif args.log:
+        with open(args.log, encoding="ascii", errors="replace") as file:
+            snapshot = parse(file)
+    else:
+        snapshot = parse(sys.stdin)
+    if snapshot is None:
+        raise SystemExit("No snapshot found")
+
+    missing = sum(1 for row in snapshot.rows if row is None)
+    for error in snapshot.errors:
+        print(error, file=sys.stderr)
+    if not snapshot.complete:
+        print("Snapshot %d is incomplete" % snapshot.nr, file=sys.stderr)
+    if missing:
+        print("%d of %d rows missing, drawn in magenta" % (missing, snapshot.height), file=sys.stderr)
+
+    if args.output.lower().endswith(".ppm"):
+        write_ppm(snapshot, args.output)
+    else:
+        write_png(snapshot, args.output)
+    print("Snapshot %d (%dx%d) written to %s" % (snapshot.nr, snapshot.width, snapshot.height, args.output))
+    return 1 if missing or not snapshot.complete else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())